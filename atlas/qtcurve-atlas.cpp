@@ -0,0 +1,295 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  qtcurve-atlas - pre-renders the tiles that QtCurve would generate for a set of settings, and
+  writes them to an atlas file. Applications started with QTCURVE_ATLAS=<file> then map this
+  file, rather than drawing the tiles themselves.
+
+  The tiles are generated by having the style draw a representative set of widgets, at several
+  sizes, in each of their common states. Each window is painted into a pixmap, via grabWidget(),
+  so that every widget is drawn - whether or not the window manager has mapped the window.
+*/
+
+#include <qapplication.h>
+#include <qstylefactory.h>
+#include <qstyle.h>
+#include <qpalette.h>
+#include <qfont.h>
+#include <qfile.h>
+#include <qdir.h>
+#include <qvbox.h>
+#include <qhbox.h>
+#include <qpushbutton.h>
+#include <qtoolbutton.h>
+#include <qcombobox.h>
+#include <qcheckbox.h>
+#include <qradiobutton.h>
+#include <qlineedit.h>
+#include <qslider.h>
+#include <qscrollbar.h>
+#include <qprogressbar.h>
+#include <qtabwidget.h>
+#include <qlistview.h>
+#include <qsplitter.h>
+#include <qspinbox.h>
+#include <qpixmap.h>
+#include <qpaintdevice.h>
+#include <qmainwindow.h>
+#include <qmenubar.h>
+#include <qpopupmenu.h>
+#include <qtoolbar.h>
+#include <iostream>
+#include <stdlib.h>
+#include <unistd.h>
+#include <X11/Xlib.h>
+
+// Point sizes at which to render the widgets - the tile sizes depend upon the widget heights...
+static const int constFontSizes[]={ 7, 8, 9, 10, 11, 12, 14, 0 };
+
+static void usage(const char *app)
+{
+    std::cerr << "Usage: " << app << " [--rc <stylerc>] [--background <colour>] [--button <colour>]"
+              << " [--highlight <colour>] <atlas>\n";
+    exit(1);
+}
+
+static QString theRcDir;
+
+// QtCurve reads its settings from $XDG_CONFIG_HOME/qtcurve/stylerc - so point this at a private
+// temporary folder containing a copy of the requested file...
+static bool useRcFile(const QString &rc)
+{
+    QFile in(rc);
+
+    if(!in.open(IO_ReadOnly))
+        return false;
+
+    const char *tmp(getenv("TMPDIR"));
+    QCString   dir(QCString(tmp && *tmp ? tmp : "/tmp")+"/qtcurve-atlas-XXXXXX");
+
+    if(!mkdtemp(dir.data()))
+        return false;
+
+    theRcDir=QFile::decodeName(dir);
+    if(!QDir().mkdir(theRcDir+"/qtcurve"))
+        return false;
+
+    QFile out(theRcDir+"/qtcurve/stylerc");
+
+    if(!out.open(IO_WriteOnly))
+        return false;
+
+    QByteArray data(in.readAll());
+    bool       ok(out.writeBlock(data)==(int)data.size());
+
+    out.close();
+    setenv("XDG_CONFIG_HOME", dir, 1);
+    return ok;
+}
+
+static void removeRcFile()
+{
+    if(theRcDir.isEmpty())
+        return;
+
+    QFile::remove(theRcDir+"/qtcurve/stylerc");
+    QDir().rmdir(theRcDir+"/qtcurve");
+    QDir().rmdir(theRcDir);
+}
+
+// Process all pending events - including those generated by the X server in response to the
+// requests made whilst processing the previous batch - so that every widget has been laid out...
+static void settle(QApplication &app)
+{
+    do
+    {
+        app.processEvents();
+        XSync(qt_xdisplay(), False);
+    }
+    while(app.hasPendingEvents());
+}
+
+static QMainWindow * createWindow(int pointSize)
+{
+    QMainWindow *mw=new QMainWindow;
+    QFont       f(QApplication::font());
+
+    f.setPointSize(pointSize);
+    mw->setFont(f);
+
+    QPopupMenu *menu=new QPopupMenu(mw);
+
+    menu->insertItem("Item");
+    mw->menuBar()->insertItem("File", menu);
+    mw->menuBar()->insertItem("Edit", new QPopupMenu(mw));
+
+    QToolBar *tb=new QToolBar(mw);
+
+    new QToolButton(Qt::UpArrow, tb);
+    new QToolButton(Qt::DownArrow, tb);
+    new QToolButton(Qt::LeftArrow, tb);
+    new QToolButton(Qt::RightArrow, tb);
+
+    QVBox *vbox=new QVBox(mw);
+    QHBox *buttons=new QHBox(vbox);
+
+    new QPushButton("Button", buttons);
+    (new QPushButton("Default", buttons))->setDefault(true);
+    (new QPushButton("Pressed", buttons))->setDown(true);
+    (new QPushButton("Disabled", buttons))->setEnabled(false);
+    (new QPushButton("Toggle", buttons))->setToggleButton(true);
+
+    QHBox *checks=new QHBox(vbox);
+
+    (new QCheckBox("Check", checks))->setChecked(true);
+    new QCheckBox("Check", checks);
+    (new QRadioButton("Radio", checks))->setChecked(true);
+    new QRadioButton("Radio", checks);
+
+    QHBox *edits=new QHBox(vbox);
+
+    new QLineEdit("Line edit", edits);
+    (new QComboBox(false, edits))->insertItem("Combo");
+    (new QComboBox(true, edits))->insertItem("Editable");
+    new QSpinBox(edits);
+
+    new QSlider(0, 100, 10, 50, Qt::Horizontal, vbox);
+    new QScrollBar(0, 100, 1, 10, 50, Qt::Horizontal, vbox);
+
+    // Splitter handles, and vertical slider and scrollbar markers...
+    QSplitter *splitter=new QSplitter(vbox);
+
+    new QSlider(0, 100, 10, 50, Qt::Vertical, splitter);
+    new QScrollBar(0, 100, 1, 10, 50, Qt::Vertical, splitter);
+
+    QProgressBar *prog=new QProgressBar(100, vbox);
+
+    prog->setProgress(50);
+
+    QTabWidget *tabs=new QTabWidget(vbox);
+
+    tabs->addTab(new QWidget(tabs), "Tab");
+    tabs->addTab(new QWidget(tabs), "Tab");
+    tabs->addTab(new QWidget(tabs), "Tab");
+
+    QTabWidget *botTabs=new QTabWidget(vbox);
+
+    botTabs->setTabPosition(QTabWidget::Bottom);
+    botTabs->addTab(new QWidget(botTabs), "Tab");
+    botTabs->addTab(new QWidget(botTabs), "Tab");
+
+    QListView *lv=new QListView(vbox);
+
+    lv->addColumn("Column");
+    lv->addColumn("Column");
+    for(int i=0; i<4; ++i)
+        new QListViewItem(lv, "Item", "Item");
+    lv->setSelected(lv->firstChild(), true);
+
+    mw->setCentralWidget(vbox);
+    return mw;
+}
+
+int main(int argc, char **argv)
+{
+    QString rc,
+            atlas;
+    QColor  bgnd,
+            button,
+            highlight;
+
+    for(int i=1; i<argc; ++i)
+    {
+        QString arg(argv[i]);
+
+        if(i+1<argc && "--rc"==arg)
+            rc=QFile::decodeName(argv[++i]);
+        else if(i+1<argc && "--background"==arg)
+            bgnd.setNamedColor(argv[++i]);
+        else if(i+1<argc && "--button"==arg)
+            button.setNamedColor(argv[++i]);
+        else if(i+1<argc && "--highlight"==arg)
+            highlight.setNamedColor(argv[++i]);
+        else if(atlas.isEmpty() && !arg.startsWith("-"))
+            atlas=QFile::decodeName(argv[i]);
+        else
+            usage(argv[0]);
+    }
+
+    if(atlas.isEmpty())
+        usage(argv[0]);
+
+    if(!rc.isEmpty() && !useRcFile(rc))
+    {
+        std::cerr << "Failed to read " << rc.local8Bit() << '\n';
+        removeRcFile();
+        return 1;
+    }
+
+    // The style records the tiles that it generates, and writes them out when it is unpolished...
+    setenv("QTCURVE_ATLAS_SAVE", QFile::encodeName(QDir(QDir::currentDirPath()).absFilePath(atlas)), 1);
+    unsetenv("QTCURVE_ATLAS");
+
+    QApplication app(argc, argv);
+    QStyle       *style=QStyleFactory::create("qtcurve");
+
+    if(!style)
+    {
+        std::cerr << "The QtCurve style plugin could not be loaded\n";
+        removeRcFile();
+        return 1;
+    }
+
+    if(bgnd.isValid() || button.isValid() || highlight.isValid())
+    {
+        QPalette pal(QApplication::palette());
+
+        for(int i=0; i<3; ++i)
+        {
+            QPalette::ColorGroup group(0==i ? QPalette::Active : 1==i ? QPalette::Inactive : QPalette::Disabled);
+
+            if(bgnd.isValid())
+                pal.setColor(group, QColorGroup::Background, bgnd);
+            if(button.isValid())
+                pal.setColor(group, QColorGroup::Button, button);
+            if(highlight.isValid())
+                pal.setColor(group, QColorGroup::Highlight, highlight);
+        }
+        app.setPalette(pal, true);
+    }
+
+    app.setStyle(style);
+
+    for(int s=0; constFontSizes[s]; ++s)
+    {
+        QMainWindow *mw=createWindow(constFontSizes[s]);
+
+        mw->show();
+        settle(app);
+        QPixmap::grabWidget(mw);
+        mw->hide();
+        delete mw;
+    }
+
+    app.setStyle("windows");
+    removeRcFile();
+    return 0;
+}
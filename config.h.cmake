@@ -9,5 +9,8 @@
 #cmakedefine QTC_DEFAULT_TO_KDE3
 #cmakedefine QTC_STYLE_SUPPORT
 #cmakedefine QTC_ENABLE_PARENTLESS_DIALOG_FIX_SUPPORT
+#cmakedefine QTC_ENABLE_PROFILER
+#cmakedefine QTC_HAVE_XSHM
+#cmakedefine QTC_HAVE_XRENDER
 
 #endif
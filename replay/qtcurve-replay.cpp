@@ -0,0 +1,391 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  qtcurve-replay - replays a trace, as recorded via QTCURVE_RECORD, against the QtCurve style
+  and reports the time taken per element. Calls are drawn into an offscreen pixmap, so this may
+  be run under Xvfb. The X server is synced before and after each call, so each timing includes
+  the time the server took to execute the call's requests.
+
+  Widgets are re-created from their (nearest Qt) class, and resized to their recorded size -
+  their other state (e.g. text, or current item) is not recorded. Calls that cannot be replayed
+  (unknown widget classes, or options that refer to other objects) are skipped and counted.
+*/
+
+#include "config.h"
+#include "recorder.h"
+#ifdef QTC_QT_ONLY
+#include "qtc_kstyle.h"
+#else
+#include <kstyle.h>
+#endif
+#include <qapplication.h>
+#include <qstylefactory.h>
+#include <qstyle.h>
+#include <qpainter.h>
+#include <qpixmap.h>
+#include <qpaintdevice.h>
+#include <qfile.h>
+#include <qdatastream.h>
+#include <qtextstream.h>
+#include <qmap.h>
+#include <qvaluelist.h>
+#include <qvaluevector.h>
+#include <qpushbutton.h>
+#include <qtoolbutton.h>
+#include <qcombobox.h>
+#include <qcheckbox.h>
+#include <qradiobutton.h>
+#include <qlineedit.h>
+#include <qslider.h>
+#include <qscrollbar.h>
+#include <qprogressbar.h>
+#include <qtabbar.h>
+#include <qheader.h>
+#include <qlistview.h>
+#include <qmenubar.h>
+#include <qpopupmenu.h>
+#include <qtoolbar.h>
+#include <qmainwindow.h>
+#include <qspinbox.h>
+#include <qgroupbox.h>
+#include <qframe.h>
+#include <iostream>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <X11/Xlib.h>
+
+#ifdef QTC_QT_ONLY
+#define BASE_STYLE QtCKStyle
+#else
+#define BASE_STYLE KStyle
+#endif
+
+// Only the categories of the public drawing API are recorded...
+#define NUM_TRACE_CATEGORIES (QtCProfiler::CAT_KSTYLE_PRIMITIVE+1)
+
+static const char * constCategoryNames[NUM_TRACE_CATEGORIES]=
+{
+    "drawPrimitive",
+    "drawControl",
+    "drawComplexControl",
+    "drawKStylePrimitive"
+};
+
+struct Call
+{
+    Q_UINT8  cat,
+             kind;
+    Q_INT32  element;
+    Q_INT16  x, y, w, h,
+             cls,
+             widgetW, widgetH;
+    Q_UINT32 flags,
+             controls,
+             active,
+             color;
+    Q_UINT16 cols;
+    Q_INT32  i1, i2;
+};
+
+struct Stats
+{
+    Stats() : calls(0), total(0.0) { }
+
+    unsigned long calls;
+    double        total;
+};
+
+static void usage(const char *app)
+{
+    std::cerr << "Usage: " << app << " [--repeat <count>] <trace>\n";
+    exit(1);
+}
+
+static bool readTrace(const QString &file, QValueList<QString> &classes, QValueList<QColorGroup> &colors,
+                      QValueVector<Call> &calls)
+{
+    QFile f(file);
+
+    if(!f.open(IO_ReadOnly))
+        return false;
+
+    QDataStream str(&f);
+    char        magic[8];
+    Q_UINT32    version;
+
+    str.readRawBytes(magic, sizeof(magic));
+    str >> version;
+    if(0!=memcmp(magic, QTC_TRACE_MAGIC, sizeof(magic)) || QTC_TRACE_VERSION!=version)
+        return false;
+
+    while(!str.atEnd())
+    {
+        Q_UINT8 type;
+
+        str >> type;
+        switch(type)
+        {
+            case REC_CLASS:
+            {
+                QCString name;
+
+                str >> name;
+                classes.append(name);
+                break;
+            }
+            case REC_COLORS:
+            {
+                QColorGroup cg;
+
+                for(int i=0; i<QColorGroup::NColorRoles; ++i)
+                {
+                    Q_UINT32 rgb;
+
+                    str >> rgb;
+                    cg.setColor((QColorGroup::ColorRole)i, QColor(rgb));
+                }
+                colors.append(cg);
+                break;
+            }
+            case REC_CALL:
+            {
+                Call call;
+
+                str >> call.cat >> call.element >> call.x >> call.y >> call.w >> call.h >> call.flags
+                    >> call.controls >> call.active >> call.cls >> call.widgetW >> call.widgetH >> call.cols
+                    >> call.kind;
+                if(OPT_INTS==call.kind)
+                    str >> call.i1 >> call.i2;
+                else if(OPT_COLOR==call.kind)
+                    str >> call.color;
+                calls.append(call);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+static QWidget * createWidget(const QString &cls, QWidget *parent)
+{
+    if("QPushButton"==cls)
+        return new QPushButton("Button", parent);
+    if("QToolButton"==cls)
+        return new QToolButton(parent);
+    if("QComboBox"==cls)
+        return new QComboBox(false, parent);
+    if("QCheckBox"==cls)
+        return new QCheckBox("Check", parent);
+    if("QRadioButton"==cls)
+        return new QRadioButton("Radio", parent);
+    if("QLineEdit"==cls)
+        return new QLineEdit(parent);
+    if("QSlider"==cls)
+        return new QSlider(Qt::Horizontal, parent);
+    if("QScrollBar"==cls)
+        return new QScrollBar(Qt::Horizontal, parent);
+    if("QProgressBar"==cls)
+        return new QProgressBar(parent);
+    if("QTabBar"==cls)
+        return new QTabBar(parent);
+    if("QHeader"==cls)
+        return new QHeader(parent);
+    if("QListView"==cls)
+        return new QListView(parent);
+    if("QMenuBar"==cls)
+        return new QMenuBar(parent);
+    if("QPopupMenu"==cls)
+        return new QPopupMenu(parent);
+    if("QSpinWidget"==cls || "QSpinBox"==cls)
+        return new QSpinBox(parent);
+    if("QGroupBox"==cls)
+        return new QGroupBox(parent);
+    if("QFrame"==cls)
+        return new QFrame(parent);
+    if("QWidget"==cls)
+        return new QWidget(parent);
+    return 0L;
+}
+
+int main(int argc, char **argv)
+{
+    QString trace;
+    int     repeat(1);
+
+    for(int i=1; i<argc; ++i)
+    {
+        QString arg(argv[i]);
+
+        if(i+1<argc && "--repeat"==arg)
+            repeat=QMAX(1, atoi(argv[++i]));
+        else if(trace.isEmpty() && !arg.startsWith("-"))
+            trace=QFile::decodeName(argv[i]);
+        else
+            usage(argv[0]);
+    }
+
+    if(trace.isEmpty())
+        usage(argv[0]);
+
+    QApplication app(argc, argv);
+    QStyle       *style=QStyleFactory::create("qtcurve");
+
+    if(!style)
+    {
+        std::cerr << "The QtCurve style plugin could not be loaded\n";
+        return 1;
+    }
+
+    app.setStyle(style);
+
+    QValueList<QString>     classes;
+    QValueList<QColorGroup> colors;
+    QValueVector<Call>      calls;
+
+    if(!readTrace(trace, classes, colors, calls))
+    {
+        std::cerr << "Failed to read " << trace.local8Bit() << '\n';
+        return 1;
+    }
+
+    // Widgets are created once per class, and resized as required...
+    QWidget                   *parent=new QWidget;
+    QMap<int, QWidget *>      widgets;
+    QPixmap                   pix(1, 1);
+    QMap<int, Stats>          stats[NUM_TRACE_CATEGORIES];
+    QMap<QString, unsigned long> skipped;
+    double                    total(0.0);
+
+    for(int r=0; r<repeat; ++r)
+        for(unsigned int c=0; c<calls.count(); ++c)
+        {
+            const Call &call(calls[c]);
+            QString    cls(call.cls>=0 && call.cls<(int)classes.count() ? classes[call.cls] : QString::null);
+
+            if(call.cat>=NUM_TRACE_CATEGORIES || call.cols>=colors.count())
+                continue;
+
+            if(OPT_OTHER==call.kind)
+            {
+                if(0==r)
+                    skipped["options"]++;
+                continue;
+            }
+
+            QWidget *widget(0L);
+
+            if(!cls.isEmpty())
+            {
+                if(widgets.contains(call.cls))
+                    widget=widgets[call.cls];
+                else
+                    widget=widgets[call.cls]=createWidget(cls, parent);
+            }
+
+            if(!widget && QtCProfiler::CAT_PRIMITIVE!=call.cat)
+            {
+                if(0==r)
+                    skipped[cls.isEmpty() ? QString("no widget") : cls]++;
+                continue;
+            }
+
+            if(widget && (widget->width()!=call.widgetW || widget->height()!=call.widgetH))
+                widget->resize(call.widgetW, call.widgetH);
+
+            QRect rect(call.x, call.y, call.w, call.h);
+
+            if(pix.width()<rect.right()+1 || pix.height()<rect.bottom()+1)
+                pix.resize(QMAX(pix.width(), rect.right()+1), QMAX(pix.height(), rect.bottom()+1));
+
+            QColor       color(call.color);
+            QStyleOption opt(OPT_INTS==call.kind
+                                ? QStyleOption(call.i1, call.i2)
+                                : OPT_COLOR==call.kind
+                                    ? QStyleOption(color)
+                                    : QStyleOption(QStyleOption::Default));
+            const QColorGroup &cg(colors[call.cols]);
+            QPainter     p(&pix);
+            struct timeval start,
+                           end;
+
+            // Flush any requests from the previous call (or from resizing the widget) first...
+            XSync(qt_xdisplay(), False);
+            gettimeofday(&start, 0L);
+            switch(call.cat)
+            {
+                case QtCProfiler::CAT_PRIMITIVE:
+                    style->drawPrimitive((QStyle::PrimitiveElement)call.element, &p, rect, cg, call.flags, opt);
+                    break;
+                case QtCProfiler::CAT_CONTROL:
+                    style->drawControl((QStyle::ControlElement)call.element, &p, widget, rect, cg, call.flags, opt);
+                    break;
+                case QtCProfiler::CAT_COMPLEX_CONTROL:
+                    style->drawComplexControl((QStyle::ComplexControl)call.element, &p, widget, rect, cg,
+                                              call.flags, call.controls, call.active, opt);
+                    break;
+                case QtCProfiler::CAT_KSTYLE_PRIMITIVE:
+                    ((BASE_STYLE *)style)->drawKStylePrimitive((BASE_STYLE::KStylePrimitive)call.element, &p,
+                                                               widget, rect, cg, call.flags, opt);
+                    break;
+            }
+            p.end();
+            XSync(qt_xdisplay(), False);
+            gettimeofday(&end, 0L);
+
+            long usecs(((end.tv_sec-start.tv_sec)*1000000L)+(end.tv_usec-start.tv_usec));
+            Stats &s(stats[call.cat][call.element]);
+
+            s.calls++;
+            s.total+=usecs;
+            total+=usecs;
+        }
+
+    QTextStream str(stdout, IO_WriteOnly);
+
+    str << "# QtCurve replay of " << trace << ", " << calls.count() << " calls, " << repeat << " time(s)\n"
+        << "# Timings include the X server - each call is followed by XSync()\n"
+        << "# name calls total(us) mean(us)\n";
+
+    for(int c=0; c<NUM_TRACE_CATEGORIES; ++c)
+    {
+        QMap<int, Stats>::ConstIterator it(stats[c].begin()),
+                                        end(stats[c].end());
+
+        for(; it!=end; ++it)
+            str << constCategoryNames[c] << ':' << it.key() << ' ' << it.data().calls << ' '
+                << (unsigned long)it.data().total << ' '
+                << (unsigned long)(it.data().calls ? it.data().total/it.data().calls : 0.0) << '\n';
+    }
+
+    QMap<QString, unsigned long>::ConstIterator it(skipped.begin()),
+                                                end(skipped.end());
+
+    for(; it!=end; ++it)
+        str << "skipped:" << it.key() << ' ' << it.data() << '\n';
+    str << "total " << (unsigned long)total << '\n';
+
+    delete parent;
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "atlas.h"
+#include <qfile.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#define ATLAS_MAGIC   "QTCATLAS"
+#define ATLAS_VERSION 2
+
+// Entry flags...
+#define ATLAS_ALPHA   0x01
+
+// Read a 32-bit little-endian value, and advance...
+static bool readUInt(const char *data, unsigned int size, unsigned int &pos, unsigned int &val)
+{
+    if(pos>size || size-pos<4)
+        return false;
+
+    const unsigned char *d=(const unsigned char *)(data+pos);
+
+    val=d[0]|(d[1]<<8)|(d[2]<<16)|(d[3]<<24);
+    pos+=4;
+    return true;
+}
+
+static void writeUInt(QByteArray &data, unsigned int &pos, unsigned int val)
+{
+    data[pos++]=val&0xFF;
+    data[pos++]=(val>>8)&0xFF;
+    data[pos++]=(val>>16)&0xFF;
+    data[pos++]=(val>>24)&0xFF;
+}
+
+Atlas * Atlas::load(const QString &file, unsigned int signature)
+{
+    int fd=::open(QFile::encodeName(file), O_RDONLY);
+
+    if(fd<0)
+        return 0L;
+
+    struct stat info;
+    void        *data=MAP_FAILED;
+
+    if(0==fstat(fd, &info) && info.st_size>0)
+        data=mmap(0L, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if(MAP_FAILED==data)
+        return 0L;
+
+    const char   *d=(const char *)data;
+    unsigned int size(info.st_size),
+                 pos(strlen(ATLAS_MAGIC)),
+                 version,
+                 sig,
+                 count;
+
+    if(size<pos || 0!=memcmp(d, ATLAS_MAGIC, pos) ||
+       !readUInt(d, size, pos, version) || ATLAS_VERSION!=version ||
+       !readUInt(d, size, pos, sig) || signature!=sig ||
+       !readUInt(d, size, pos, count))
+    {
+        munmap(data, size);
+        return 0L;
+    }
+
+    Atlas *atlas=new Atlas(d, size);
+
+    // The checks are arranged so that they cannot overflow. Any bad entry means that the file is
+    // truncated, or corrupt, so none of it is used...
+    for(unsigned int i=0; i<count; ++i)
+    {
+        unsigned int len,
+                     flags;
+        Entry        entry;
+
+        if(!readUInt(d, size, pos, len) || len>size-pos)
+        {
+            delete atlas;
+            return 0L;
+        }
+
+        QString key(QString::fromLatin1(d+pos, len));
+
+        pos+=len;
+        if(!readUInt(d, size, pos, entry.width) || !readUInt(d, size, pos, entry.height) ||
+           !readUInt(d, size, pos, flags) || !readUInt(d, size, pos, entry.offset) ||
+           0==entry.width || 0==entry.height || 0!=(entry.offset%4) || entry.offset>size ||
+           entry.height>(size-entry.offset)/4/entry.width)
+        {
+            delete atlas;
+            return 0L;
+        }
+
+        entry.alpha=flags&ATLAS_ALPHA;
+        atlas->itsEntries[key]=entry;
+    }
+
+    return atlas;
+}
+
+bool Atlas::save(const QString &file, unsigned int signature, const QMap<QString, QImage> &images)
+{
+    QMap<QString, QImage>::ConstIterator it(images.begin()),
+                                         end(images.end());
+    unsigned int                         indexSize(strlen(ATLAS_MAGIC)+12),
+                                         dataSize(0);
+
+    for(; it!=end; ++it)
+    {
+        indexSize+=20+it.key().length();
+        dataSize+=it.data().width()*it.data().height()*4;
+    }
+
+    // Image data is aligned to 4 bytes, so that it can be used as is...
+    indexSize=(indexSize+3)&~3;
+
+    QByteArray   data(indexSize+dataSize);
+    unsigned int pos(0),
+                 offset(indexSize);
+
+    memset(data.data(), 0, data.size());
+    memcpy(data.data(), ATLAS_MAGIC, strlen(ATLAS_MAGIC));
+    pos+=strlen(ATLAS_MAGIC);
+    writeUInt(data, pos, ATLAS_VERSION);
+    writeUInt(data, pos, signature);
+    writeUInt(data, pos, images.count());
+
+    for(it=images.begin(); it!=end; ++it)
+    {
+        QImage       img(it.data().convertDepth(32));
+        QCString     key(it.key().latin1());
+        unsigned int len(key.length());
+
+        writeUInt(data, pos, len);
+        memcpy(data.data()+pos, key.data(), len);
+        pos+=len;
+        writeUInt(data, pos, img.width());
+        writeUInt(data, pos, img.height());
+        writeUInt(data, pos, it.data().hasAlphaBuffer() ? ATLAS_ALPHA : 0);
+        writeUInt(data, pos, offset);
+
+        for(int y=0; y<img.height(); ++y)
+        {
+            memcpy(data.data()+offset, img.scanLine(y), img.width()*4);
+            offset+=img.width()*4;
+        }
+    }
+
+    // Write to a temporary file, and then rename this over the atlas - so that applications that map
+    // the atlas never see a partially written file...
+    QCString dest(QFile::encodeName(file)),
+             tmp(dest+".tmp."+QCString().setNum(getpid()));
+    int      fd=::open(tmp, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+
+    if(fd<0)
+        return false;
+
+    bool         ok(true);
+    const char   *d(data.data());
+    unsigned int left(data.size());
+
+    while(ok && left)
+    {
+        ssize_t written=::write(fd, d, left);
+
+        if(written<0)
+            ok=EINTR==errno;
+        else
+        {
+            d+=written;
+            left-=written;
+        }
+    }
+
+    ok=0==::fsync(fd) && ok;
+    ok=0==::close(fd) && ok;
+
+    if(!ok || 0!=::rename(tmp, dest))
+    {
+        ::unlink(tmp);
+        return false;
+    }
+    return true;
+}
+
+Atlas::Atlas(const char *data, unsigned int size)
+     : itsData(data)
+     , itsSize(size)
+{
+}
+
+Atlas::~Atlas()
+{
+    munmap((void *)itsData, itsSize);
+}
+
+bool Atlas::find(const QString &key, QImage &img) const
+{
+    QMap<QString, Entry>::ConstIterator it(itsEntries.find(key));
+
+    if(it==itsEntries.end())
+        return false;
+
+    // Refer to the mapped data directly - the image is only read when uploaded...
+    img=QImage((uchar *)(itsData+it.data().offset), it.data().width, it.data().height, 32, 0L, 0,
+               QImage::IgnoreEndian);
+    img.setAlphaBuffer(it.data().alpha);
+    return true;
+}
@@ -0,0 +1,70 @@
+#ifndef __QTC_ATLAS_H__
+#define __QTC_ATLAS_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Pre-rendered tiles, as written by qtcurve-atlas. The file consists of a header, an index of
+  pixmap cache keys, and the 32-bit image data of each tile (in host byte order). The only flag
+  marks tiles whose alpha channel is used. The file is mmap'ed, and tiles are only converted to
+  pixmaps when first needed.
+
+  The header records a signature of the settings that affect the tiles' contents but are not
+  part of their keys (e.g. custom gradients), so a stale atlas is ignored.
+
+    "QTCATLAS" <version> <signature> <count>
+    <count> x { <key length> <key (latin1)> <width> <height> <flags> <offset> }
+    <data>
+*/
+
+#include <qstring.h>
+#include <qmap.h>
+#include <qimage.h>
+
+class Atlas
+{
+    public:
+
+    static Atlas * load(const QString &file, unsigned int signature);
+    static bool    save(const QString &file, unsigned int signature, const QMap<QString, QImage> &images);
+
+    ~Atlas();
+
+    bool find(const QString &key, QImage &img) const;
+
+    private:
+
+    struct Entry
+    {
+        unsigned int width,
+                     height,
+                     offset;
+        bool         alpha;
+    };
+
+    Atlas(const char *data, unsigned int size);
+
+    const char            *itsData;
+    unsigned int          itsSize;
+    QMap<QString, Entry>  itsEntries;
+};
+
+#endif
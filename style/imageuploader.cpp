@@ -0,0 +1,239 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "config.h"
+#include "imageuploader.h"
+#include "profiler.h"
+#include <qpixmap.h>
+#include <qimage.h>
+#include <qpaintdevice.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#ifdef QTC_HAVE_XSHM
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <X11/extensions/XShm.h>
+#endif
+#include "qtc_fixx11h.h"
+
+// The segment is kept for re-use, and only re-created if a larger image is uploaded...
+#define MIN_SEGMENT_SIZE 65536
+// Each shared memory upload costs a round trip, so smaller images are sent via the socket...
+#define MIN_SHM_IMAGE_SIZE 65536
+
+#ifdef QTC_HAVE_XSHM
+struct ImageUploader::Segment
+{
+    XShmSegmentInfo info;
+    unsigned int    size;
+};
+
+static bool theShmError=false;
+
+static int shmErrorHandler(Display *, XErrorEvent *)
+{
+    theShmError=true;
+    return 0;
+}
+
+static int hostByteOrder()
+{
+    int one=1;
+
+    return *((char *)&one) ? LSBFirst : MSBFirst;
+}
+#else
+struct ImageUploader::Segment
+{
+};
+#endif
+
+ImageUploader::ImageUploader(bool remote)
+             : itsState(remote ? STATE_UNAVAILABLE : STATE_UNKNOWN)
+             , itsSegment(0L)
+             , itsGc(0L)
+{
+}
+
+ImageUploader::~ImageUploader()
+{
+#ifdef QTC_HAVE_XSHM
+    // The style is deleted before QApplication closes the display...
+    release();
+    if(itsGc)
+        XFreeGC(qt_xdisplay(), (GC)itsGc);
+#endif
+}
+
+bool ImageUploader::accelerated(unsigned int bytes)
+{
+    return bytes>=MIN_SHM_IMAGE_SIZE && available();
+}
+
+bool ImageUploader::available()
+{
+#ifdef QTC_HAVE_XSHM
+    if(STATE_UNKNOWN==itsState)
+    {
+        Display *dpy=qt_xdisplay();
+        Visual  *visual=(Visual *)QPaintDevice::x11AppVisual();
+        int     major,
+                minor;
+        Bool    pixmaps;
+
+        // Only handle the common case, where QImage data can be copied as is...
+        itsState=XShmQueryVersion(dpy, &major, &minor, &pixmaps) && 24==QPaintDevice::x11AppDepth() &&
+                 TrueColor==visual->c_class && 0xFF0000==visual->red_mask && 0x00FF00==visual->green_mask &&
+                 0x0000FF==visual->blue_mask && attach(MIN_SEGMENT_SIZE)
+                    ? STATE_AVAILABLE
+                    : STATE_UNAVAILABLE;
+    }
+#endif
+    return STATE_AVAILABLE==itsState;
+}
+
+void ImageUploader::upload(QPixmap &pix, const QImage &img)
+{
+    if(!img.hasAlphaBuffer() && 32==img.depth() && accelerated(img.numBytes()) && shmUpload(pix, img))
+    {
+        QTC_COUNT("upload bytes: MIT-SHM", img.numBytes());
+        return;
+    }
+
+    pix.convertFromImage(img);
+    QTC_COUNT("upload bytes: socket", img.numBytes());
+}
+
+bool ImageUploader::attach(unsigned int size)
+{
+#ifdef QTC_HAVE_XSHM
+    Display *dpy=qt_xdisplay();
+    Segment *seg=new Segment;
+
+    seg->size=size;
+    seg->info.readOnly=True;
+    seg->info.shmid=shmget(IPC_PRIVATE, size, IPC_CREAT|0600);
+    if(seg->info.shmid<0)
+    {
+        delete seg;
+        return false;
+    }
+
+    seg->info.shmaddr=(char *)shmat(seg->info.shmid, 0L, 0);
+
+    if((char *)-1==seg->info.shmaddr)
+    {
+        shmctl(seg->info.shmid, IPC_RMID, 0L);
+        delete seg;
+        return false;
+    }
+
+    // XShmAttach fails asynchronously - e.g. if the server is not really local...
+    XErrorHandler oldHandler=XSetErrorHandler(shmErrorHandler);
+
+    theShmError=false;
+    XShmAttach(dpy, &seg->info);
+    XSync(dpy, False);
+    XSetErrorHandler(oldHandler);
+
+    // Mark the segment for removal now, so that it is freed once both sides have detached - even
+    // if the application crashes...
+    shmctl(seg->info.shmid, IPC_RMID, 0L);
+
+    if(theShmError)
+    {
+        shmdt(seg->info.shmaddr);
+        delete seg;
+        return false;
+    }
+
+    itsSegment=seg;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ImageUploader::release()
+{
+#ifdef QTC_HAVE_XSHM
+    if(itsSegment)
+    {
+        XShmDetach(qt_xdisplay(), &itsSegment->info);
+        XSync(qt_xdisplay(), False);
+        shmdt(itsSegment->info.shmaddr);
+        delete itsSegment;
+        itsSegment=0L;
+    }
+#endif
+}
+
+bool ImageUploader::shmUpload(QPixmap &pix, const QImage &img)
+{
+#ifdef QTC_HAVE_XSHM
+    int          w(img.width()),
+                 h(img.height());
+    unsigned int size(w*h*4);
+
+    if(!itsSegment || itsSegment->size<size)
+    {
+        release();
+        if(!attach(size>MIN_SEGMENT_SIZE ? size : MIN_SEGMENT_SIZE))
+        {
+            itsState=STATE_UNAVAILABLE;
+            return false;
+        }
+    }
+
+    Display *dpy=qt_xdisplay();
+    XImage  *xi=XShmCreateImage(dpy, (Visual *)QPaintDevice::x11AppVisual(), QPaintDevice::x11AppDepth(),
+                                ZPixmap, itsSegment->info.shmaddr, &itsSegment->info, w, h);
+
+    if(!xi)
+        return false;
+
+    if(32!=xi->bits_per_pixel || hostByteOrder()!=xi->byte_order || w*4!=xi->bytes_per_line)
+    {
+        // XDestroyImage would otherwise free() the shared memory...
+        xi->data=0L;
+        XDestroyImage(xi);
+        itsState=STATE_UNAVAILABLE;
+        return false;
+    }
+
+    for(int y=0; y<h; ++y)
+        memcpy(xi->data+(y*xi->bytes_per_line), img.scanLine(y), w*4);
+
+    if(pix.width()!=w || pix.height()!=h)
+        pix.resize(w, h);
+    if(!itsGc)
+        itsGc=XCreateGC(dpy, pix.handle(), 0, 0L);
+
+    XShmPutImage(dpy, pix.handle(), (GC)itsGc, xi, 0, 0, 0, 0, w, h, False);
+    // The segment is re-used for the next image, so wait until the server has read this one...
+    XSync(dpy, False);
+    xi->data=0L;
+    XDestroyImage(xi);
+    return true;
+#else
+    return false;
+#endif
+}
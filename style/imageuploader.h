@@ -0,0 +1,67 @@
+#ifndef __IMAGE_UPLOADER_H__
+#define __IMAGE_UPLOADER_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Converts client-side images into pixmaps. If the X server is local, and supports MIT-SHM, then
+  large opaque 32-bit images are passed via a shared memory segment - rather than being streamed
+  over the socket. As the segment is re-used, each such upload waits for the server to read it, so
+  smaller images are cheaper to send via the socket. Anything else (images with alpha, remote servers, unusual visuals) falls back to
+  QPixmap::convertFromImage. The extension is only queried upon first use.
+*/
+
+class QPixmap;
+class QImage;
+
+class ImageUploader
+{
+    public:
+
+    ImageUploader(bool remote);
+    ~ImageUploader();
+
+    // Whether an opaque image of this many bytes would be uploaded via shared memory...
+    bool accelerated(unsigned int bytes);
+    void upload(QPixmap &pix, const QImage &img);
+
+    private:
+
+    enum EState
+    {
+        STATE_UNKNOWN,
+        STATE_AVAILABLE,
+        STATE_UNAVAILABLE
+    };
+
+    struct Segment;
+
+    bool available();
+    bool attach(unsigned int size);
+    void release();
+    bool shmUpload(QPixmap &pix, const QImage &img);
+
+    EState  itsState;
+    Segment *itsSegment;
+    void    *itsGc;
+};
+
+#endif
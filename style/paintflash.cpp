@@ -0,0 +1,138 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "paintflash.h"
+#include <qwidget.h>
+#include <qpainter.h>
+#include <qtimer.h>
+#include <qevent.h>
+#include <qtl.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+// How long, in milliseconds, to leave the tint visible...
+#define FLASH_DURATION 250
+
+struct PaintCount
+{
+    PaintCount(unsigned long c=0, const QString &n=QString::null) : count(c), name(n) { }
+
+    // Sort most painted first...
+    bool operator<(const PaintCount &o) const { return count>o.count; }
+
+    unsigned long count;
+    QString       name;
+};
+
+bool PaintFlash::enabled()
+{
+    return NULL!=getenv("QTCURVE_PAINT_FLASH");
+}
+
+PaintFlash::PaintFlash(QObject *parent)
+          : QObject(parent)
+          , itsDepth(0)
+          , itsClearing(0L)
+          , itsTimer(new QTimer(this))
+{
+    connect(itsTimer, SIGNAL(timeout()), this, SLOT(clearFlashes()));
+}
+
+PaintFlash::~PaintFlash()
+{
+    QValueList<PaintCount>                       counts;
+    QMap<QString, unsigned long>::ConstIterator it(itsPaintCount.begin()),
+                                                end(itsPaintCount.end());
+
+    for(; it!=end; ++it)
+        counts.append(PaintCount(it.data(), it.key()));
+
+    qHeapSort(counts);
+
+    fprintf(stderr, "QtCurve: Paint events per widget:\n");
+
+    QValueList<PaintCount>::ConstIterator cit(counts.begin()),
+                                          cend(counts.end());
+
+    for(; cit!=cend; ++cit)
+        fprintf(stderr, "%10lu %s\n", (*cit).count, (*cit).name.latin1());
+}
+
+void PaintFlash::leave(QPainter *p, const QRect &r, const QWidget *widget)
+{
+    if(--itsDepth>0 || !p || !r.isValid())
+        return;
+
+    QWidget *w=(QWidget *)(widget ? widget : dynamic_cast<const QWidget *>(p->device()));
+
+    // Can only remove the tint if we know which widget to repaint...
+    if(!w || w==itsClearing)
+        return;
+
+    static const QColor constCols[]={ Qt::red, Qt::green, Qt::blue, Qt::yellow, Qt::magenta, Qt::cyan };
+
+    if(!itsFlashCount.contains(w))
+        connect(w, SIGNAL(destroyed(QObject *)), this, SLOT(widgetDestroyed(QObject *)));
+
+    unsigned int count(itsFlashCount[w]++);
+
+    p->save();
+    p->fillRect(r, QBrush(constCols[count%(sizeof(constCols)/sizeof(QColor))], Qt::Dense5Pattern));
+    p->restore();
+
+    if(!itsFlashed.contains(w))
+        itsFlashed.append(w);
+    if(!itsTimer->isActive())
+        itsTimer->start(FLASH_DURATION, true);
+}
+
+void PaintFlash::clearFlashes()
+{
+    QValueList<QWidget *> flashed(itsFlashed);
+
+    itsFlashed.clear();
+
+    QValueList<QWidget *>::ConstIterator it(flashed.begin()),
+                                         end(flashed.end());
+
+    for(; it!=end; ++it)
+    {
+        // repaint() is synchronous, so anything drawn for this widget in the meantime is not tinted.
+        itsClearing=*it;
+        itsClearing->repaint(false);
+    }
+    itsClearing=0L;
+}
+
+void PaintFlash::widgetDestroyed(QObject *o)
+{
+    itsFlashed.remove(static_cast<QWidget *>(o));
+    itsFlashCount.remove(static_cast<QWidget *>(o));
+}
+
+bool PaintFlash::eventFilter(QObject *o, QEvent *e)
+{
+    if(QEvent::Paint==e->type() && o->isWidgetType() && o!=itsClearing)
+        itsPaintCount[QString(o->className())+" \""+o->name()+'\"']++;
+
+    return QObject::eventFilter(o, e);
+}
+
+#include "paintflash.moc"
@@ -0,0 +1,103 @@
+#ifndef __PAINT_FLASH_H__
+#define __PAINT_FLASH_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Debug aid - enabled by setting QTCURVE_PAINT_FLASH in the environment.
+
+  Every area drawn via the style is tinted for a short time, and then the widget is repainted
+  to remove the tint. The tint colour cycles with each repaint, so areas that are repainted
+  several times in quick succession stand out. The number of paint events received by each
+  widget is printed to stderr upon exit.
+*/
+
+#include <qobject.h>
+#include <qvaluelist.h>
+#include <qmap.h>
+#include <qrect.h>
+
+class QWidget;
+class QPainter;
+class QTimer;
+
+class PaintFlash : public QObject
+{
+    Q_OBJECT
+
+    public:
+
+    explicit PaintFlash(QObject *parent = 0);
+    virtual ~PaintFlash();
+
+    void enter() { itsDepth++; }
+    void leave(QPainter *p, const QRect &r, const QWidget *widget);
+
+    static bool enabled();
+
+    private slots:
+
+    void clearFlashes();
+    void widgetDestroyed(QObject *o);
+
+    protected:
+
+    bool eventFilter(QObject *watched, QEvent *event);
+
+    private:
+
+    int                           itsDepth;
+    QWidget                       *itsClearing;
+    QTimer                        *itsTimer;
+    QValueList<QWidget *>         itsFlashed;
+    QMap<QWidget *, unsigned int> itsFlashCount;
+    QMap<QString, unsigned long>  itsPaintCount;
+};
+
+//
+// Created at the start of each of the style's drawing entry points. Only the outermost call
+// tints the area drawn.
+class PaintFlashGuard
+{
+    public:
+
+    PaintFlashGuard(PaintFlash *flash, QPainter *p, const QRect &r, const QWidget *widget)
+        : itsFlash(flash), itsPainter(p), itsRect(r), itsWidget(widget)
+    {
+        if(itsFlash)
+            itsFlash->enter();
+    }
+
+    ~PaintFlashGuard()
+    {
+        if(itsFlash)
+            itsFlash->leave(itsPainter, itsRect, itsWidget);
+    }
+
+    private:
+
+    PaintFlash    *itsFlash;
+    QPainter      *itsPainter;
+    QRect         itsRect;
+    const QWidget *itsWidget;
+};
+
+#endif
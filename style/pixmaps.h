@@ -1,260 +1,365 @@
-#ifndef _QEMBED_1804289383
-#define _QEMBED_1804289383
-static const unsigned int  radio_frame_png_len = 419;
-static const unsigned char radio_frame_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,0x08,0x04,0x00,0x00,
-    0x00,0xd8,0xe2,0x2c,0xf7,0x00,0x00,0x01,0x6a,0x49,0x44,0x41,0x54,0x18,
-    0x19,0x01,0x5f,0x01,0xa0,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x15,0x00,0x74,0x00,0xd5,0x00,0xff,0x00,0xd5,0x00,0x74,0x00,0x15,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0xdc,
-    0x00,0x21,0x00,0x75,0x00,0x33,0x00,0x73,0x00,0x20,0x00,0xdd,0x00,0x5b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x00,0xd2,0x00,0x38,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x00,0xd3,0x00,
-    0x5b,0x00,0x00,0x00,0x00,0x15,0x00,0xf0,0x00,0x3a,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0xf0,
-    0x00,0x15,0x03,0x00,0x6a,0x00,0xe5,0x00,0x98,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0x00,0x1f,0x00,
-    0x1e,0x00,0x00,0xd5,0x00,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x00,0xd5,
-    0x00,0x00,0xff,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x00,0xff,0x02,
-    0x00,0xd6,0x00,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0xd6,0x03,0x00,
-    0x0a,0x00,0x39,0x00,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x00,0xbc,0x00,0x00,0x15,
-    0x00,0xf3,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x3a,0x00,0xf3,0x00,0x15,0x00,0x00,0x00,0x00,
-    0x5b,0x00,0xda,0x00,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x39,0x00,0xd9,0x00,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x5b,0x00,0xf4,0x00,0x9f,0x00,0x53,0x00,0x39,0x00,0x4f,0x00,0x9d,
-    0x00,0xf5,0x00,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x15,0x00,0x74,0x00,0xd5,0x00,0xff,0x00,0xd5,0x00,0x74,0x00,
-    0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x26,0x73,0x80,0x50,0xef,
-    0x36,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+#ifndef __QTC_PIXMAPS_H__
+#define __QTC_PIXMAPS_H__
+
+/*
+  Images used by QtCurveStyle::getPixmap(), pre-decoded from the PNG files that used to be embedded
+  here via qembed - so that no PNG decoding, or rotation, is required at runtime. The vertical slider
+  variants are stored already rotated (and mirrored).
+
+  Pixels are stored row by row as QRgb (0xAARRGGBB) values. These are not premultiplied, as this is
+  the format of Qt3's 32-bit QImage.
+*/
+
+enum EImage
+{
+    IMG_RADIO_FRAME,
+    IMG_RADIO_INNER,
+    IMG_RADIO_LIGHT,
+    IMG_RADIO_ON,
+    IMG_RADIO_ON_SMALL,
+    IMG_CHECK_ON,
+    IMG_CHECK_X_ON,
+    IMG_SLIDER,
+    IMG_SLIDER_LIGHT,
+    IMG_SLIDER_V,
+    IMG_SLIDER_LIGHT_V,
+    IMG_DOT,
+    NUM_IMAGES
+};
+
+static const unsigned int radio_frame_data[] = {
+    0x00000000,0x00000000,0x00000000,0x15000000,0x74000000,0xd5000000,0xff000000,0xd5000000,
+    0x74000000,0x15000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5b000000,
+    0xf1000000,0x95000000,0x4a000000,0x32000000,0x48000000,0x94000000,0xf2000000,0x5b000000,
+    0x00000000,0x00000000,0x00000000,0x5b000000,0xd2000000,0x38000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x34000000,0xd3000000,0x5b000000,0x00000000,0x15000000,
+    0xf0000000,0x3a000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x36000000,0xf0000000,0x15000000,0x74000000,0x97000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x97000000,
+    0x74000000,0xd5000000,0x52000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x4f000000,0xd5000000,0xff000000,0x3e000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x39000000,0xff000000,0xd5000000,0x55000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x50000000,0xd5000000,
+    0x74000000,0x9d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x9c000000,0x74000000,0x15000000,0xf3000000,0x3f000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3a000000,
+    0xf3000000,0x15000000,0x00000000,0x5b000000,0xda000000,0x3d000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x39000000,0xd9000000,0x5b000000,0x00000000,0x00000000,
+    0x00000000,0x5b000000,0xf4000000,0x9f000000,0x53000000,0x39000000,0x4f000000,0x9d000000,
+    0xf5000000,0x5b000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x15000000,
+    0x74000000,0xd5000000,0xff000000,0xd5000000,0x74000000,0x15000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-/* Generated by qembed */
-static const unsigned int  radio_inner_png_len = 276;
-static const unsigned char radio_inner_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,0x08,0x04,0x00,0x00,
-    0x00,0xd8,0xe2,0x2c,0xf7,0x00,0x00,0x00,0x01,0x73,0x52,0x47,0x42,0x00,
-    0xae,0xce,0x1c,0xe9,0x00,0x00,0x00,0x02,0x62,0x4b,0x47,0x44,0x00,0x00,
-    0xaa,0x8d,0x23,0x32,0x00,0x00,0x00,0x09,0x70,0x48,0x59,0x73,0x00,0x00,
-    0x0b,0x13,0x00,0x00,0x0b,0x13,0x01,0x00,0x9a,0x9c,0x18,0x00,0x00,0x00,
-    0x07,0x74,0x49,0x4d,0x45,0x07,0xd8,0x0c,0x0a,0x0c,0x30,0x0e,0xa9,0x10,
-    0xdb,0x17,0x00,0x00,0x00,0x98,0x49,0x44,0x41,0x54,0x18,0xd3,0x85,0x8c,
-    0x31,0x0a,0xc2,0x40,0x10,0x45,0x1f,0x62,0x95,0x9b,0x18,0x16,0x6b,0xf1,
-    0x08,0xa6,0xf5,0x04,0x36,0x5a,0x59,0x6e,0x61,0x9b,0x0b,0x04,0xcc,0x01,
-    0x2c,0x72,0x0c,0x6b,0x3d,0x81,0x85,0x20,0x04,0x0b,0x31,0x45,0x18,0x85,
-    0x80,0x36,0x81,0x58,0x0c,0x92,0x65,0x40,0xfc,0xd5,0x1b,0xde,0xfc,0x0f,
-    0x7f,0x33,0xc4,0x23,0x74,0xbc,0xc8,0x88,0x42,0xe1,0x28,0xa9,0xd9,0x30,
-    0x65,0xc9,0x85,0x07,0xb3,0xbe,0x51,0xb2,0x0f,0x1e,0x73,0x6e,0xc4,0x8a,
-    0x9e,0xda,0xcc,0x9f,0xd8,0x2a,0x08,0xa9,0x51,0x0b,0x2a,0x85,0x8e,0xc4,
-    0x28,0x47,0x0b,0x03,0xe0,0xcd,0xd8,0xa8,0x11,0x8d,0x42,0xc6,0xd5,0xa8,
-    0x03,0x85,0x42,0xc4,0x93,0x5d,0x20,0x3c,0xc2,0xe4,0x7b,0x24,0xdc,0x39,
-    0xb3,0xc2,0x31,0xe7,0x88,0xb0,0x0e,0x27,0x62,0x72,0x2a,0x5a,0x84,0xa2,
-    0x6f,0xfc,0xcc,0x07,0xef,0xe8,0x26,0x2e,0x6f,0x29,0xb2,0x5f,0x00,0x00,
-    0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+static const unsigned int radio_inner_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x04000000,0x76000000,0xee000000,0xff000000,0xf6000000,0x90000000,0x0a000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x2c000000,0xdf000000,0xec000000,0x7a000000,
+    0x3a000000,0x67000000,0xdc000000,0xef000000,0x4a000000,0x00000000,0x00000000,0x00000000,
+    0x04000000,0xdf000000,0xbc000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x94000000,0xe5000000,0x2a000000,0x00000000,0x00000000,0x76000000,0xec000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd5000000,0x93000000,
+    0x00000000,0x00000000,0xee000000,0x83000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x62000000,0xe8000000,0x00000000,0x00000000,0xff000000,
+    0x4b000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x2c000000,0xfc000000,0x00000000,0x00000000,0xf6000000,0x79000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x55000000,0xef000000,0x00000000,
+    0x00000000,0x90000000,0xe1000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0xc6000000,0xa4000000,0x00000000,0x00000000,0x0a000000,0xf0000000,
+    0xa0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x76000000,0xee000000,
+    0x38000000,0x00000000,0x00000000,0x00000000,0x4b000000,0xe7000000,0xd9000000,0x68000000,
+    0x2c000000,0x54000000,0xc7000000,0xee000000,0x6e000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x2a000000,0x94000000,0xe8000000,0xfc000000,0xee000000,0xa4000000,
+    0x38000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  radio_light_png_len = 236;
-static const unsigned char radio_light_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,0x08,0x04,0x00,0x00,
-    0x00,0xd8,0xe2,0x2c,0xf7,0x00,0x00,0x00,0x02,0x62,0x4b,0x47,0x44,0x00,
-    0xff,0x87,0x8f,0xcc,0xbf,0x00,0x00,0x00,0x09,0x70,0x48,0x59,0x73,0x00,
-    0x00,0x0b,0x13,0x00,0x00,0x0b,0x13,0x01,0x00,0x9a,0x9c,0x18,0x00,0x00,
-    0x00,0x07,0x74,0x49,0x4d,0x45,0x07,0xd6,0x09,0x13,0x09,0x3a,0x1a,0x90,
-    0x15,0xd3,0x1e,0x00,0x00,0x00,0x7d,0x49,0x44,0x41,0x54,0x18,0xd3,0x9d,
-    0xcf,0xa1,0x0a,0xc2,0x60,0x18,0x85,0xe1,0xe7,0xdf,0x06,0x83,0xe1,0x2d,
-    0x88,0x58,0xd6,0x0d,0x62,0x5d,0xf0,0x02,0xac,0x36,0x2f,0xc5,0xe4,0x35,
-    0x79,0x17,0x76,0x41,0xc1,0x22,0x18,0x0c,0x03,0xb3,0xbf,0x61,0xc3,0xe0,
-    0xfe,0x15,0xdf,0x78,0x3e,0xde,0xc3,0xf9,0x18,0x25,0x07,0x85,0x99,0x8d,
-    0x93,0xbd,0xd2,0x54,0xeb,0xe5,0x4d,0x86,0xc2,0xca,0x55,0xad,0x51,0x3b,
-    0xaa,0x2d,0x04,0xa1,0x33,0xe7,0xa2,0xad,0x49,0xdf,0x53,0xf5,0x4d,0x60,
-    0xe7,0xf0,0x3d,0xfc,0x10,0xad,0x53,0x71,0x06,0x1e,0x63,0x0b,0x4b,0x4f,
-    0x97,0xb4,0x75,0xb6,0x54,0xa5,0xad,0xd6,0xdd,0x6d,0x90,0xc7,0xee,0xe1,
-    0x7c,0xa0,0x04,0x7f,0xf2,0x01,0x0c,0x7b,0x12,0xeb,0xfa,0x6c,0x4b,0xe7,
-    0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+static const unsigned int radio_light_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,
+    0x21000000,0x60000000,0xff000000,0xff000000,0x86000000,0x60000000,0x21000000,0x04000000,
+    0x00000000,0x00000000,0x00000000,0x04000000,0x3b000000,0xff000000,0x86000000,0x3f000000,
+    0x25000000,0x3e000000,0x86000000,0x52000000,0x05000000,0x01000000,0x00000000,0x00000000,
+    0x21000000,0xff000000,0x59000000,0x0c000000,0x00000000,0x00000000,0x00000000,0x0a000000,
+    0x03000000,0x00000000,0x00000000,0x00000000,0x00000000,0x60000000,0x86000000,0x0c000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0xff000000,0x44000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,
+    0x2d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x86000000,0x46000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x60000000,0x7b000000,0x0a000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21000000,0x34000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x03000000,0x00000000,0x00000000,0x04000000,0x03000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  radio_on_png_len = 221;
-static const unsigned char radio_on_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,0x08,0x06,0x00,0x00,
-    0x00,0x72,0xeb,0xe4,0x7c,0x00,0x00,0x00,0x01,0x73,0x52,0x47,0x42,0x00,
-    0xae,0xce,0x1c,0xe9,0x00,0x00,0x00,0x06,0x62,0x4b,0x47,0x44,0x00,0xff,
-    0x00,0xff,0x00,0xff,0xa0,0xbd,0xa7,0x93,0x00,0x00,0x00,0x09,0x70,0x48,
-    0x59,0x73,0x00,0x00,0x0b,0x13,0x00,0x00,0x0b,0x13,0x01,0x00,0x9a,0x9c,
-    0x18,0x00,0x00,0x00,0x07,0x74,0x49,0x4d,0x45,0x07,0xd9,0x04,0x11,0x0a,
-    0x2d,0x0a,0x29,0xa8,0x47,0x5a,0x00,0x00,0x00,0x5d,0x49,0x44,0x41,0x54,
-    0x28,0xcf,0xd5,0xd0,0xb1,0x09,0x80,0x40,0x0c,0x05,0xd0,0xa7,0x56,0xb6,
-    0x37,0x8d,0x23,0xe8,0x44,0xae,0xe8,0x0c,0x62,0x69,0x7d,0x33,0xd8,0x9c,
-    0xa0,0xe1,0x0a,0x0b,0x0b,0xfd,0xf0,0x09,0x81,0xbc,0x26,0xfc,0x2e,0x23,
-    0x16,0xac,0x65,0x8e,0x4f,0xc0,0x5a,0xe9,0x0d,0x36,0x01,0x2d,0x48,0xc8,
-    0x65,0x4f,0x65,0x66,0x0c,0xe7,0x51,0x1b,0xd0,0x15,0xa8,0xe0,0x2a,0xca,
-    0xe1,0x20,0x05,0x0c,0xba,0x80,0x76,0x4c,0xe8,0x4b,0xcf,0xcc,0xd8,0x5e,
-    0xfd,0xde,0xc7,0x72,0x00,0x70,0x62,0x14,0x61,0xef,0x49,0xda,0x94,0x00,
-    0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+static const unsigned int radio_on_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x48000000,0xc8000000,0xda000000,0xc8000000,0x48000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48000000,
+    0xda000000,0xda000000,0xda000000,0xda000000,0xda000000,0x48000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xc8000000,0xda000000,0xc8000000,0xc8000000,
+    0xda000000,0xda000000,0xc8000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xda000000,0xc8000000,0xc8000000,0xc8000000,0xc8000000,0xda000000,0xda000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc8000000,0xda000000,
+    0xc8000000,0xc8000000,0xda000000,0xda000000,0xc8000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x48000000,0xda000000,0xda000000,0xda000000,0xda000000,
+    0xda000000,0x48000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x48000000,0xc8000000,0xda000000,0xc8000000,0x48000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  radio_on_small_png_len = 258;
-static const unsigned char radio_on_small_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0d,0x08,0x06,0x00,0x00,
-    0x00,0x72,0xeb,0xe4,0x7c,0x00,0x00,0x00,0x01,0x73,0x52,0x47,0x42,0x00,
-    0xae,0xce,0x1c,0xe9,0x00,0x00,0x00,0x06,0x62,0x4b,0x47,0x44,0x00,0xff,
-    0x00,0xff,0x00,0xff,0xa0,0xbd,0xa7,0x93,0x00,0x00,0x00,0x09,0x70,0x48,
-    0x59,0x73,0x00,0x00,0x0b,0x13,0x00,0x00,0x0b,0x13,0x01,0x00,0x9a,0x9c,
-    0x18,0x00,0x00,0x00,0x07,0x74,0x49,0x4d,0x45,0x07,0xd9,0x0a,0x14,0x0b,
-    0x13,0x19,0x65,0xff,0x39,0x9d,0x00,0x00,0x00,0x82,0x49,0x44,0x41,0x54,
-    0x28,0xcf,0xcd,0xd0,0x31,0x0a,0xc2,0x50,0x10,0x04,0xd0,0xa7,0x82,0xf0,
-    0x41,0x9b,0x78,0x0b,0xdb,0x9c,0xc1,0xc6,0xeb,0xa4,0xcf,0x65,0x2c,0x3c,
-    0x84,0x07,0x51,0x1b,0x0b,0x49,0x6b,0x0a,0x45,0x02,0x22,0x62,0xb3,0x82,
-    0x04,0x63,0x95,0x22,0xd3,0x0c,0x3b,0xcc,0xcc,0x2e,0xcb,0xa0,0x31,0xfa,
-    0xa1,0x25,0xac,0x90,0xa1,0xc6,0x0e,0xcd,0xbf,0x92,0x84,0x12,0x07,0x54,
-    0xd8,0xc7,0x9c,0xbe,0x4d,0x93,0x56,0x68,0x8d,0x02,0x77,0x5c,0x31,0xc3,
-    0x12,0x27,0x1c,0x3f,0xa6,0x71,0x2b,0xb4,0xc0,0x0b,0x8f,0xe0,0x1a,0xf3,
-    0x38,0x55,0x57,0xe8,0x12,0xda,0x34,0x38,0xc3,0x2d,0xc2,0x9d,0xe7,0x9d,
-    0xa3,0x39,0x8f,0xad,0x0d,0xb6,0xd8,0xe0,0xd9,0xeb,0xf7,0x06,0x86,0x37,
-    0x26,0x03,0x19,0xb1,0xe6,0xd3,0x1d,0x4f,0x00,0x00,0x00,0x00,0x49,0x45,
-    0x4e,0x44,0xae,0x42,0x60,0x82
+static const unsigned int radio_on_small_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x09000000,0x4e000000,0x60000000,0x4e000000,0x09000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09000000,
+    0x7e000000,0xd8000000,0xe4000000,0xd7000000,0x7e000000,0x09000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x4e000000,0xd9000000,0xcd000000,0xca000000,
+    0xdc000000,0xd7000000,0x4e000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x61000000,0xd7000000,0xc7000000,0xc8000000,0xca000000,0xe4000000,0x60000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4e000000,0xd9000000,
+    0xcd000000,0xca000000,0xdc000000,0xd7000000,0x4e000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x09000000,0x7e000000,0xd8000000,0xe4000000,0xd7000000,
+    0x7e000000,0x09000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x09000000,0x4e000000,0x60000000,0x4e000000,0x09000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  check_on_png_len = 179;
-static const unsigned char check_on_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x08,0x06,0x00,0x00,
-    0x00,0xe0,0x91,0x06,0x10,0x00,0x00,0x00,0x7a,0x49,0x44,0x41,0x54,0x18,
-    0x95,0x75,0xce,0x2d,0x0e,0xc2,0x60,0x10,0x84,0xe1,0x87,0x70,0x00,0x0e,
-    0x40,0xc2,0x8f,0xe8,0xc1,0xd0,0x08,0xae,0x81,0xc0,0xd5,0x70,0x05,0x2e,
-    0xc0,0x39,0xa8,0x03,0x89,0x04,0x51,0x09,0x69,0x41,0x60,0xb6,0xc9,0xa6,
-    0xe1,0x1b,0xb5,0x3b,0xfb,0x66,0x76,0x26,0xca,0x5a,0xe1,0x88,0x59,0x09,
-    0x58,0xe2,0x8e,0xdb,0x60,0xac,0x51,0x25,0x60,0x8e,0x0b,0xde,0x58,0x0c,
-    0xe6,0x13,0x1d,0xf6,0xb1,0xef,0xf0,0x45,0x9d,0xa3,0xb7,0xe8,0xf1,0xc1,
-    0x06,0x2d,0x5e,0xff,0x3a,0x1c,0x02,0xea,0x23,0xe5,0x54,0x2a,0xdb,0x04,
-    0xd0,0xe5,0x2e,0x63,0x55,0xf1,0xa6,0x19,0x1f,0xa6,0x69,0x6e,0xf1,0xc0,
-    0x19,0xd7,0x0c,0xfd,0x00,0x7a,0x3f,0x1a,0x54,0x34,0x8d,0x19,0xdc,0x00,
-    0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+static const unsigned int check_on_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20000000,0xb8000000,
+    0xc7000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1f000000,0xe1000000,
+    0xd9000000,0x00000000,0x21000000,0x25000000,0x00000000,0x00000000,0x1b000000,0xd0000000,
+    0xf7000000,0x1e000000,0x00000000,0xea000000,0xf9000000,0x88000000,0x00000000,0x6f000000,
+    0xfc000000,0x93000000,0x00000000,0x00000000,0x6b000000,0xfa000000,0xfb000000,0x61000000,
+    0xee000000,0xf6000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8c000000,0xfb000000,
+    0xfa000000,0xfc000000,0xa9000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xd1000000,0xfc000000,0xf9000000,0x1e000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x25000000,0xf6000000,0xd1000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x64000000,0x50000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  slider_png_len = 311;
-static const unsigned char slider_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x0d,0x08,0x06,0x00,0x00,
-    0x00,0x46,0x92,0x25,0x60,0x00,0x00,0x00,0x06,0x62,0x4b,0x47,0x44,0x00,
-    0xff,0x00,0xff,0x00,0xff,0xa0,0xbd,0xa7,0x93,0x00,0x00,0x00,0x09,0x70,
-    0x48,0x59,0x73,0x00,0x00,0x0b,0x13,0x00,0x00,0x0b,0x13,0x01,0x00,0x9a,
-    0x9c,0x18,0x00,0x00,0x00,0x07,0x74,0x49,0x4d,0x45,0x07,0xd7,0x06,0x19,
-    0x0b,0x21,0x06,0x08,0x17,0x34,0xb5,0x00,0x00,0x00,0xc4,0x49,0x44,0x41,
-    0x54,0x38,0xcb,0xad,0xd3,0x31,0x6a,0x02,0x41,0x18,0x40,0xe1,0xcf,0xc5,
-    0x2b,0x4c,0x6c,0xac,0x2c,0xad,0x83,0x44,0x41,0x6c,0x2d,0x24,0xb5,0x90,
-    0x3e,0x90,0xde,0x5c,0x25,0x5e,0xc0,0x54,0x29,0x13,0xb0,0xf0,0x16,0x8a,
-    0x82,0x42,0xac,0x44,0x52,0x58,0x08,0x39,0x40,0xd2,0xcc,0x86,0x8d,0x8d,
-    0xe2,0xce,0x83,0x81,0x29,0x7e,0x1e,0x33,0xf0,0x3f,0xfe,0x13,0x30,0xc2,
-    0x12,0x3f,0x17,0x9c,0x65,0x9c,0x0f,0x45,0x49,0xb5,0x70,0x7f,0xc0,0x0b,
-    0x26,0x78,0xc6,0x97,0xf3,0xdc,0x60,0x80,0x4f,0x3c,0xe1,0xd5,0x89,0x70,
-    0x8e,0x3b,0xd7,0x71,0x8b,0x45,0xf4,0xfc,0x7d,0xf9,0x88,0x8e,0x72,0xb4,
-    0xa2,0x27,0x54,0xf0,0x8e,0x5d,0x7c,0x7e,0x59,0xc6,0xa8,0x67,0x68,0x60,
-    0x26,0x0d,0x33,0x34,0x32,0x34,0x71,0x48,0x24,0x3d,0xa0,0x99,0x61,0x85,
-    0x5a,0x22,0x69,0x0d,0xab,0x0c,0x5b,0xf4,0x13,0x49,0xfb,0xd1,0x27,0xe0,
-    0x1b,0xbd,0x92,0xc2,0x4e,0xf4,0x84,0xe2,0x9e,0x6e,0xd0,0xbd,0x52,0xd8,
-    0xc6,0x3a,0xdf,0xd3,0xbc,0xa8,0xbc,0x84,0x29,0xde,0xf0,0x81,0xfd,0x85,
-    0x45,0xdd,0x63,0x88,0xc7,0xd3,0xa2,0x92,0xb6,0xff,0x0b,0xa5,0xee,0x37,
-    0x87,0x80,0xd0,0x1f,0x2b,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,
-    0x42,0x60,0x82
+static const unsigned int check_x_on_data[] = {
+    0x7c000000,0xd4000000,0x7c000000,0x00000000,0x00000000,0x00000000,0x7c000000,0xd4000000,
+    0x7c000000,0xd4000000,0xd4000000,0xd4000000,0x7c000000,0x00000000,0x7c000000,0xd4000000,
+    0xd4000000,0xd4000000,0x7c000000,0xd4000000,0xd4000000,0xd4000000,0x7c000000,0xd4000000,
+    0xd4000000,0xd4000000,0x7c000000,0x00000000,0x7c000000,0xd4000000,0xd4000000,0xd4000000,
+    0xd4000000,0xd4000000,0x7c000000,0x00000000,0x00000000,0x00000000,0x7c000000,0xd4000000,
+    0xd4000000,0xd4000000,0x7c000000,0x00000000,0x00000000,0x00000000,0x7c000000,0xd4000000,
+    0xd4000000,0xd4000000,0xd4000000,0xd4000000,0x7c000000,0x00000000,0x7c000000,0xd4000000,
+    0xd4000000,0xd4000000,0x7c000000,0xd4000000,0xd4000000,0xd4000000,0x7c000000,0xd4000000,
+    0xd4000000,0xd4000000,0x7c000000,0x00000000,0x7c000000,0xd4000000,0xd4000000,0xd4000000,
+    0x7c000000,0xd4000000,0x7c000000,0x00000000,0x00000000,0x00000000,0x7c000000,0xd4000000,
+    0x7c000000
 };
 
-static const unsigned int  slider_light_png_len = 199;
-static const unsigned char slider_light_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x0d,0x08,0x06,0x00,0x00,
-    0x00,0x46,0x92,0x25,0x60,0x00,0x00,0x00,0x8e,0x49,0x44,0x41,0x54,0x38,
-    0xcb,0xe5,0xd2,0x31,0x0a,0xc2,0x60,0x0c,0x86,0xe1,0x07,0x5b,0x10,0xa4,
-    0x27,0x70,0xeb,0x21,0xc4,0xc5,0xc1,0x41,0xf0,0x0c,0xdd,0xfe,0xd3,0xe8,
-    0x31,0xbc,0x8c,0x8b,0x57,0x10,0x1c,0x5c,0x04,0x07,0x07,0x77,0xa1,0x2e,
-    0xa9,0x74,0x12,0x2b,0xbf,0x93,0x1f,0x84,0x04,0x42,0xde,0x7c,0x81,0xf0,
-    0x63,0x95,0xa8,0x91,0xd0,0x0e,0x88,0x14,0x73,0x65,0x1f,0xd4,0xe5,0x39,
-    0xf6,0xd8,0x62,0x89,0xcb,0x07,0x46,0xa6,0x58,0x63,0x87,0x05,0x0e,0x78,
-    0x74,0xcd,0x3a,0xb6,0x36,0xa8,0x06,0x5e,0x58,0xc5,0x5c,0x13,0x9c,0x97,
-    0x12,0x36,0x5f,0x00,0xdf,0xaa,0xc5,0x2a,0x17,0x6c,0xd4,0xab,0xaf,0xb9,
-    0xa0,0x45,0xe4,0x31,0x6e,0x38,0xe5,0x74,0x7a,0xc4,0x0c,0x93,0x9c,0x4e,
-    0xef,0xf1,0x42,0xe7,0xdc,0x8f,0x5f,0xf8,0x3b,0x3d,0x01,0x15,0xcd,0x1c,
-    0xe6,0xf8,0x5d,0xc5,0xb1,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,
-    0x42,0x60,0x82
+static const unsigned int slider_data[] = {
+    0x00000000,0x00000000,0x00000000,0x15000000,0x74000000,0xd5000000,0xff000000,0xff000000,
+    0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,0xd5000000,
+    0x74000000,0x15000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5b000000,
+    0xf1000000,0x95000000,0x4a000000,0x32000000,0x32000000,0x32000000,0x32000000,0x32000000,
+    0x32000000,0x32000000,0x32000000,0x32000000,0x48000000,0x94000000,0xf2000000,0x5b000000,
+    0x00000000,0x00000000,0x00000000,0x5b000000,0xd2000000,0x38000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x34000000,0xd3000000,0x5b000000,0x00000000,0x15000000,
+    0xf0000000,0x3a000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x36000000,0xf0000000,0x15000000,0xb3000000,0x97000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x97000000,
+    0xb3000000,0xd5000000,0x52000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x52000000,0xd5000000,0xff000000,0x3e000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x3e000000,0xff000000,0xd5000000,0x55000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x55000000,0xd5000000,
+    0xb3000000,0x9d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x9d000000,0xb3000000,0x15000000,0xf3000000,0x3f000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3a000000,
+    0xf3000000,0x15000000,0x00000000,0x5b000000,0xda000000,0x3d000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x39000000,0xd9000000,0x5b000000,0x00000000,0x00000000,
+    0x00000000,0x5b000000,0xf4000000,0x9f000000,0x53000000,0x39000000,0x39000000,0x39000000,
+    0x39000000,0x39000000,0x39000000,0x39000000,0x39000000,0x39000000,0x4f000000,0x9d000000,
+    0xf5000000,0x5b000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x15000000,
+    0x74000000,0xd5000000,0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,
+    0xff000000,0xff000000,0xff000000,0xd5000000,0x74000000,0x15000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  check_x_on_png_len = 154;
-static const unsigned char check_x_on_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x09,0x08,0x06,0x00,0x00,
-    0x00,0xe0,0x91,0x06,0x10,0x00,0x00,0x00,0x61,0x49,0x44,0x41,0x54,0x18,
-    0x95,0x6d,0x8f,0x41,0x11,0xc0,0x30,0x08,0x04,0xb7,0x83,0x83,0xea,0x88,
-    0xa0,0x88,0xe9,0xb3,0x1a,0xaa,0x01,0x1d,0xd1,0x50,0x41,0xfd,0x5c,0x12,
-    0x60,0xca,0xef,0x60,0xe1,0x0e,0x03,0x2e,0xe0,0x01,0x4e,0x60,0xb0,0x6b,
-    0xf5,0x0f,0xe0,0x0d,0x03,0x07,0x6e,0x01,0x7d,0x36,0x4d,0x17,0x9a,0x74,
-    0x93,0xee,0x71,0xd1,0x64,0x51,0xc1,0x74,0xd9,0x24,0x2a,0x18,0xad,0x99,
-    0x50,0xca,0x50,0xac,0x87,0xfd,0x00,0x5e,0x33,0x9a,0xde,0xac,0x16,0x29,
-    0x63,0xfc,0x6e,0x65,0x28,0x19,0xfd,0x03,0xc4,0xa9,0x14,0xf0,0x37,0xcf,
-    0xd8,0xd2,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+static const unsigned int slider_light_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,
+    0x21000000,0x60000000,0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,
+    0xff000000,0xff000000,0xff000000,0xff000000,0xff000000,0x60000000,0x21000000,0x04000000,
+    0x00000000,0x00000000,0x00000000,0x04000000,0x3b000000,0xff000000,0x86000000,0x3f000000,
+    0x25000000,0x25000000,0x25000000,0x25000000,0x25000000,0x25000000,0x25000000,0x25000000,
+    0x25000000,0x3f000000,0x86000000,0xff000000,0x3b000000,0x04000000,0x00000000,0x00000000,
+    0x21000000,0xff000000,0x59000000,0x0c000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0c000000,
+    0x59000000,0x59000000,0x21000000,0x00000000,0x00000000,0x60000000,0x86000000,0x0c000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0xff000000,0x44000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,
+    0x2d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x86000000,0x46000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x60000000,0x7b000000,0x0a000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21000000,0x34000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x04000000,0x03000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const unsigned int  dot_png_len = 130;
-static const unsigned char dot_png_data[] = {
-    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,
-    0x44,0x52,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x08,0x04,0x00,0x00,
-    0x00,0x27,0x66,0xee,0x6e,0x00,0x00,0x00,0x01,0x73,0x52,0x47,0x42,0x00,
-    0xae,0xce,0x1c,0xe9,0x00,0x00,0x00,0x02,0x62,0x4b,0x47,0x44,0x00,0xff,
-    0x87,0x8f,0xcc,0xbf,0x00,0x00,0x00,0x2e,0x49,0x44,0x41,0x54,0x08,0xd7,
-    0x63,0x64,0xe0,0x62,0x88,0x63,0x50,0x64,0xf8,0xc7,0x30,0x8f,0x81,0x21,
-    0x83,0x41,0x8d,0x81,0x81,0x81,0x81,0xa1,0x8e,0x81,0xa1,0x97,0x01,0x0a,
-    0x98,0x18,0xfe,0x32,0xc0,0x81,0x2a,0x43,0x33,0x84,0x01,0x00,0xb7,0x94,
-    0x05,0x67,0x58,0x92,0xdc,0x0c,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,
-    0xae,0x42,0x60,0x82
+static const unsigned int slider_v_data[] = {
+    0x00000000,0x00000000,0x00000000,0x15000000,0xb3000000,0xd5000000,0xff000000,0xd5000000,
+    0xb3000000,0x15000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5b000000,
+    0xf3000000,0x9d000000,0x55000000,0x3e000000,0x52000000,0x97000000,0xf0000000,0x5b000000,
+    0x00000000,0x00000000,0x00000000,0x5b000000,0xda000000,0x3f000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x3a000000,0xd2000000,0x5b000000,0x00000000,0x15000000,
+    0xf4000000,0x3d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x38000000,0xf1000000,0x15000000,0x74000000,0x9f000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x95000000,
+    0x74000000,0xd5000000,0x53000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x4a000000,0xd5000000,0xff000000,0x39000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x32000000,0xff000000,0xff000000,0x39000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x32000000,0xff000000,
+    0xff000000,0x39000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x32000000,0xff000000,0xff000000,0x39000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x32000000,0xff000000,0xff000000,0x39000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x32000000,0xff000000,0xff000000,
+    0x39000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x32000000,0xff000000,0xff000000,0x39000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x32000000,
+    0xff000000,0xff000000,0x39000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x32000000,0xff000000,0xff000000,0x39000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x32000000,0xff000000,0xd5000000,0x4f000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48000000,0xd5000000,
+    0x74000000,0x9d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x94000000,0x74000000,0x15000000,0xf5000000,0x39000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x34000000,
+    0xf2000000,0x15000000,0x00000000,0x5b000000,0xd9000000,0x3a000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x36000000,0xd3000000,0x5b000000,0x00000000,0x00000000,
+    0x00000000,0x5b000000,0xf3000000,0x9d000000,0x55000000,0x3e000000,0x52000000,0x97000000,
+    0xf0000000,0x5b000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x15000000,
+    0xb3000000,0xd5000000,0xff000000,0xd5000000,0xb3000000,0x15000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-#include <qcstring.h>
-#include <qdict.h>
-static struct Embed {
-    unsigned int size;
-    const unsigned char *data;
-    const char *name;
-} embed_vec[] = {
-    { 419, radio_frame_png_data, "radio_frame.png" },
-    { 276, radio_inner_png_data, "radio_inner.png" },
-    { 236, radio_light_png_data, "radio_light.png" },
-    { 221, radio_on_png_data, "radio_on.png" },
-    { 258, radio_on_small_png_data, "radio_on_small.png" },
-    { 179, check_on_png_data, "check_on.png" },
-    { 311, slider_png_data, "slider.png" },
-    { 199, slider_light_png_data, "slider_light.png" },
-    { 154, check_x_on_png_data, "check_x_on.png" },
-    { 130, dot_png_data, "dot.png" },
-    { 0, 0, 0 }
+static const unsigned int slider_light_v_data[] = {
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,
+    0x21000000,0x60000000,0xff000000,0xff000000,0x86000000,0x60000000,0x21000000,0x04000000,
+    0x00000000,0x00000000,0x00000000,0x04000000,0x3b000000,0xff000000,0x86000000,0x44000000,
+    0x2d000000,0x46000000,0x7b000000,0x34000000,0x03000000,0x00000000,0x00000000,0x00000000,
+    0x21000000,0xff000000,0x59000000,0x0c000000,0x00000000,0x00000000,0x00000000,0x0a000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x60000000,0x86000000,0x0c000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0xff000000,0x3f000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,
+    0x25000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,0x25000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xff000000,0x25000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,0x25000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xff000000,0x25000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xff000000,0x25000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,0x25000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0xff000000,0x25000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,
+    0x25000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xff000000,0x3f000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x60000000,0x86000000,0x0c000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21000000,0xff000000,
+    0x59000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x04000000,0x3b000000,0x59000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x04000000,0x21000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000
 };
 
-static const QByteArray& qembed_findData( const char* name )
+static const unsigned int dot_data[] = {
+    0x0a000000,0x68000000,0x89000000,0x87000000,0x25000000,0x68000000,0x26000000,0x00000000,
+    0x00000000,0x7e000000,0x8d000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8a000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x25000000,0x83000000,0x00000000,0x00000000,
+    0x00000000
+};
+
+struct QtCImage
+{
+    int                width,
+                       height;
+    const unsigned int *data;
+};
+
+static const QtCImage constImages[NUM_IMAGES]=
 {
-    static QDict<QByteArray> dict;
-    QByteArray* ba = dict.find( name );
-    if ( !ba ) {
-	for ( int i = 0; embed_vec[i].data; i++ ) {
-	    if ( strcmp(embed_vec[i].name, name) == 0 ) {
-		ba = new QByteArray;
-		ba->setRawData( (char*)embed_vec[i].data,
-				embed_vec[i].size );
-		dict.insert( name, ba );
-		break;
-	    }
-	}
-	if ( !ba ) {
-	    static QByteArray dummy;
-	    return dummy;
-	}
-    }
-    return *ba;
-}
+    { 13, 13, radio_frame_data },
+    { 13, 13, radio_inner_data },
+    { 13, 13, radio_light_data },
+    { 13, 13, radio_on_data },
+    { 13, 13, radio_on_small_data },
+    { 9, 9, check_on_data },
+    { 9, 9, check_x_on_data },
+    { 21, 13, slider_data },
+    { 21, 13, slider_light_data },
+    { 13, 21, slider_v_data },
+    { 13, 21, slider_light_v_data },
+    { 5, 5, dot_data }
+};
 
 #endif
@@ -0,0 +1,191 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "profiler.h"
+
+#ifdef QTC_ENABLE_PROFILER
+
+#include <qwidget.h>
+#include <qpainter.h>
+#include <qapplication.h>
+#include <qfile.h>
+#include <qtextstream.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char * constCategoryNames[QtCProfiler::NUM_CATEGORIES]=
+{
+    "drawPrimitive",
+    "drawControl",
+    "drawComplexControl",
+    "drawKStylePrimitive",
+    "drawLightBevel",
+    "drawBorder",
+    "drawBevelGradient"
+};
+
+static QtCProfiler *theProfiler=0L;
+
+QtCProfiler::Stats::Stats()
+               : calls(0),
+                 total(0.0)
+{
+    for(int i=0; i<NUM_BUCKETS; ++i)
+        buckets[i]=0;
+}
+
+void QtCProfiler::Stats::add(long usecs)
+{
+    int bucket(0);
+
+    for(long limit=1; bucket<NUM_BUCKETS-1 && usecs>=limit; limit<<=1)
+        bucket++;
+
+    calls++;
+    total+=usecs;
+    buckets[bucket]++;
+}
+
+QtCProfiler * QtCProfiler::instance()
+{
+    static bool checked=false;
+
+    if(!checked)
+    {
+        const char *env=getenv("QTCURVE_PROFILE");
+
+        checked=true;
+        if(env)
+        {
+            theProfiler=new QtCProfiler(0==strcmp(env, "1") ? QString::null : QFile::decodeName(env));
+            qAddPostRoutine(cleanup);
+        }
+    }
+
+    return theProfiler;
+}
+
+QtCProfiler::QtCProfiler(const QString &file)
+           : itsFile(file)
+{
+}
+
+void QtCProfiler::cleanup()
+{
+    if(theProfiler)
+    {
+        theProfiler->dump();
+        delete theProfiler;
+        theProfiler=0L;
+    }
+}
+
+void QtCProfiler::record(ECategory cat, int element, const char *className, long usecs)
+{
+    itsElements[cat][element].add(usecs);
+    if(className)
+        itsClasses[className].add(usecs);
+}
+
+static void dumpStats(QTextStream &str, const QString &name, const QtCProfiler::Stats &stats)
+{
+    str << name << ' ' << stats.calls << ' ' << (unsigned long)stats.total << ' '
+        << (unsigned long)(stats.calls ? stats.total/stats.calls : 0.0);
+
+    for(int i=0; i<QtCProfiler::NUM_BUCKETS; ++i)
+        str << ' ' << stats.buckets[i];
+    str << '\n';
+}
+
+void QtCProfiler::dump() const
+{
+    QFile f;
+    bool  ok(false);
+
+    if(itsFile.isEmpty())
+        ok=f.open(IO_WriteOnly, stderr);
+    else
+    {
+        f.setName(itsFile);
+        ok=f.open(IO_WriteOnly|IO_Truncate);
+    }
+
+    if(!ok)
+        return;
+
+    QTextStream str(&f);
+
+    str << "# QtCurve paint profile for " << qApp->argv()[0] << '\n'
+        << "# name calls total(us) mean(us) histogram(<1us <2us <4us ... >=" << (1<<(NUM_BUCKETS-2)) << "us)\n";
+
+    for(int c=0; c<NUM_CATEGORIES; ++c)
+    {
+        QMap<int, Stats>::ConstIterator it(itsElements[c].begin()),
+                                        end(itsElements[c].end());
+
+        for(; it!=end; ++it)
+            dumpStats(str, QString(constCategoryNames[c])+':'+QString::number(it.key()), it.data());
+    }
+
+    QMap<QString, Stats>::ConstIterator it(itsClasses.begin()),
+                                        end(itsClasses.end());
+
+    for(; it!=end; ++it)
+        dumpStats(str, QString("class:")+it.key(), it.data());
+
+    QMap<QString, unsigned long>::ConstIterator cit(itsCounters.begin()),
+                                                cend(itsCounters.end());
+
+    for(; cit!=cend; ++cit)
+        str << "count:" << cit.key() << ' ' << cit.data() << '\n';
+
+    f.close();
+}
+
+QtCProfileTimer::QtCProfileTimer(QtCProfiler::ECategory cat, int element, const QWidget *widget, const QPainter *p)
+               : itsProfiler(QtCProfiler::instance()),
+                 itsCat(cat),
+                 itsElement(element),
+                 itsClassName(0L)
+{
+    if(itsProfiler)
+    {
+        if(!widget && p && p->device())
+            widget=dynamic_cast<const QWidget *>(p->device());
+        if(widget)
+            itsClassName=widget->className();
+        gettimeofday(&itsStart, 0L);
+    }
+}
+
+QtCProfileTimer::~QtCProfileTimer()
+{
+    if(itsProfiler)
+    {
+        struct timeval end;
+
+        gettimeofday(&end, 0L);
+        itsProfiler->record(itsCat, itsElement, itsClassName,
+                            ((end.tv_sec-itsStart.tv_sec)*1000000L)+(end.tv_usec-itsStart.tv_usec));
+    }
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef __QTC_PROFILER_H__
+#define __QTC_PROFILER_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Paint-time profiler.
+
+  Only compiled in if cmake is passed -DQTC_ENABLE_PROFILER=true, otherwise the QTC_PROFILE
+  macro expands to nothing. When compiled in, profiling is enabled by setting QTCURVE_PROFILE
+  in the environment - either to a filename, or to 1 to print the results to stderr. Results
+  are written when the application exits.
+
+  Times are inclusive, i.e. the time recorded for a drawControl call also includes any
+  drawLightBevel, etc, calls made whilst drawing that control.
+
+  Named event counters (e.g. cache hits) may also be recorded, via QTC_COUNT.
+*/
+
+#include "config.h"
+
+#ifdef QTC_ENABLE_PROFILER
+
+#include <qstring.h>
+#include <qmap.h>
+#include <sys/time.h>
+
+class QWidget;
+class QPainter;
+
+class QtCProfiler
+{
+    public:
+
+    enum ECategory
+    {
+        CAT_PRIMITIVE,
+        CAT_CONTROL,
+        CAT_COMPLEX_CONTROL,
+        CAT_KSTYLE_PRIMITIVE,
+        CAT_LIGHT_BEVEL,
+        CAT_BORDER,
+        CAT_BEVEL_GRADIENT,
+
+        NUM_CATEGORIES
+    };
+
+    enum
+    {
+        NUM_BUCKETS = 16 // Bucket n holds calls taking less than 2^n micro-seconds
+    };
+
+    struct Stats
+    {
+        Stats();
+
+        void add(long usecs);
+
+        unsigned long calls;
+        double        total;
+        unsigned long buckets[NUM_BUCKETS];
+    };
+
+    static QtCProfiler * instance();
+
+    void record(ECategory cat, int element, const char *className, long usecs);
+    void count(const char *name, unsigned long n) { itsCounters[name]+=n; }
+    void dump() const;
+
+    private:
+
+    QtCProfiler(const QString &file);
+
+    static void cleanup();
+
+    QString                itsFile;
+    QMap<int, Stats>       itsElements[NUM_CATEGORIES];
+    QMap<QString, Stats>   itsClasses;
+    QMap<QString, unsigned long> itsCounters;
+};
+
+class QtCProfileTimer
+{
+    public:
+
+    QtCProfileTimer(QtCProfiler::ECategory cat, int element, const QWidget *widget, const QPainter *p=0L);
+    ~QtCProfileTimer();
+
+    private:
+
+    QtCProfiler            *itsProfiler;
+    QtCProfiler::ECategory itsCat;
+    int                    itsElement;
+    const char             *itsClassName;
+    struct timeval         itsStart;
+};
+
+#define QTC_PROFILE(CAT, ELEMENT, WIDGET, PAINTER) \
+    QtCProfileTimer qtcProfileTimer(QtCProfiler::CAT, (int)(ELEMENT), WIDGET, PAINTER)
+
+#define QTC_COUNT(NAME, N) \
+    do { if(QtCProfiler::instance()) QtCProfiler::instance()->count(NAME, N); } while(0)
+
+#else
+
+#define QTC_PROFILE(CAT, ELEMENT, WIDGET, PAINTER)
+#define QTC_COUNT(NAME, N)
+
+#endif
+
+#endif
@@ -109,6 +109,14 @@ dimension, so as to draw the scrollbar at the correct size.
 #include <iostream>
 #include "qtcurve.h"
 #include "shortcuthandler.h"
+#include "profiler.h"
+#include "recorder.h"
+#include "paintflash.h"
+#include "repaintmonitor.h"
+#include "windowproperties.h"
+#include "imageuploader.h"
+#include "sharedpixmaps.h"
+#include "atlas.h"
 #include "config_file.h"
 #include "colorutils.h"
 #include "pixmaps.h"
@@ -122,9 +130,13 @@ dimension, so as to draw the scrollbar at the correct size.
 #include <qmetaobject.h>
 #include <X11/Xlib.h>
 #include <X11/Xatom.h>
+#if defined QTC_HAVE_XRENDER && !defined QT_NO_XFTFREETYPE
+#define QTC_USE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
 #include "qtc_fixx11h.h"
+#include "xatoms.h"
 
-static const Atom constNetMoveResize = XInternAtom(qt_xdisplay(), "_NET_WM_MOVERESIZE", False);
 static const QWidget * getTopLevel(const QWidget *widget)
 {
     const QWidget *w=widget;
@@ -134,40 +146,13 @@ static const QWidget * getTopLevel(const QWidget *widget)
     return w;
 }
 
-static void emitMenuSize(const QWidget *widget, unsigned short size)
-{
-    const QWidget *w=getTopLevel(widget);
-
-    if(w)
-    {
-        static const Atom constAtom = XInternAtom(qt_xdisplay(), MENU_SIZE_ATOM, False);
-        XChangeProperty(qt_xdisplay(), w->parentWidget() ? w->parentWidget()->winId() : w->winId(),
-                        constAtom, XA_CARDINAL, 16, PropModeReplace, (unsigned char *)&size, 1);
-    }
-}
-
-void setBgndProp(QWidget *widget, unsigned short app)
-{
-    const QWidget *w=getTopLevel(widget);
-
-    if(w)
-    {
-        static const Atom constAtom = XInternAtom(qt_xdisplay(), BGND_ATOM, False);
-        unsigned long prop=((APPEARANCE_STRIPED==app || APPEARANCE_FILE==app ? app : APPEARANCE_FLAT)&0xFF) |
-                           (widget->palette().active().background().rgb()&0x00FFFFFF)<<8;
-
-        XChangeProperty(qt_xdisplay(), w->parentWidget() ? w->parentWidget()->winId() : w->winId(),
-                        constAtom, XA_CARDINAL, 32, PropModeReplace, (unsigned char *)&prop, 1);
-    }
-}
-
 static void triggerWMMove(const QWidget *w, const QPoint &p)
 {
     //...Taken from bespin...
     // stolen... errr "adapted!" from QSizeGrip
     XEvent xev;
     xev.xclient.type = ClientMessage;
-    xev.xclient.message_type = constNetMoveResize;
+    xev.xclient.message_type = qtcAtom(ATOM_NET_WM_MOVERESIZE);
     xev.xclient.display = qt_xdisplay();
     xev.xclient.window = w->parentWidget() ? w->parentWidget()->winId() : w->winId();
     xev.xclient.format = 32;
@@ -184,6 +169,24 @@ static void triggerWMMove(const QWidget *w, const QPoint &p)
 #define MO_ARROW_X(FLAGS, COL) (MO_NONE!=opts.coloredMouseOver && FLAGS&Style_MouseOver && FLAGS&Style_Enabled ? itsMouseOverCols[ARROW_MO_SHADE] : COL)
 #define MO_ARROW(COL)          MO_ARROW_X(flags, COL)
 
+void QtCurveStyle::emitMenuSize(const QWidget *widget, unsigned short size)
+{
+    const QWidget *w=getTopLevel(widget);
+
+    if(w)
+        itsWindowProperties->set(w, WindowProperties::PROP_MENU_SIZE, size);
+}
+
+void QtCurveStyle::setBgndProp(QWidget *widget, unsigned short app)
+{
+    const QWidget *w=getTopLevel(widget);
+
+    if(w)
+        itsWindowProperties->set(w, WindowProperties::PROP_BGND,
+                                 ((APPEARANCE_STRIPED==app || APPEARANCE_FILE==app ? app : APPEARANCE_FLAT)&0xFF) |
+                                 (widget->palette().active().background().rgb()&0x00FFFFFF)<<8);
+}
+
 static void adjustToolbarButtons(const QWidget *widget, const QToolBar *toolbar, int &leftAdjust, int &topAdjust,
                                  int &rightAdjust, int &bottomAdjust, int &round)
 {
@@ -425,6 +428,10 @@ Q_EXPORT_PLUGIN(QtCurveStylePlugin)
 #define LISTVIEW_ITEM      0x20000000
 #define MENU_ITEM          0x40000000
 #define WINDOWTITLE_SPACER     0x10000000
+// Set on the flags of anything drawn for a KHTML form widget (or anything else that must not use
+// the cached, etched or pixel-AA'd paths). Worked out from the widget at each draw entry point, and
+// passed down with the flags - so it is correct whenever the paint actually happens...
+#define FORM_WIDGET        0x00800000
 
 #define DW_BGND 105
 
@@ -725,17 +732,81 @@ static bool onToolBar(QWidget *widget, int l=0)
 
 #define PIXMAP_DIMENSION 10
 
-enum ECacheFlags
+// Budget, in bytes, for itsPixmapCache...
+#define PIXMAP_CACHE_COST      524288
+// Gradient tiles are lengthened, so that long bars need only a few blits - but each tile is kept
+// within this many bytes...
+#define MAX_GRADIENT_TILE_COST 16384
+#define MAX_GRADIENT_TILES     4
+
+static int gradientTileLength(int length, int size)
 {
-    CACHE_STD,
-    CACHE_COL_SEL_TAB
-};
+    int len(PIXMAP_DIMENSION);
 
-static QString createKey(int size, QRgb color, QRgb bgnd, bool horiz, int app, ECacheFlags flags)
+    while(len*MAX_GRADIENT_TILES<length && len*2*size*4<=MAX_GRADIENT_TILE_COST)
+        len*=2;
+    return len;
+}
+
+// Determine whether X requests will have to travel over the network. Local displays are normally
+// accessed via a unix socket (":0", "unix:0"), whereas ssh -X and XDMCP displays specify a host
+// (e.g. "localhost:10.0").
+static bool isRemoteDisplay()
+{
+    QString display(getenv("DISPLAY")),
+            host(display.section(':', 0, 0));
+
+    if(host.isEmpty() || "unix"==host || display.startsWith("/"))
+        return false;
+
+    char hostName[256];
+
+    hostName[sizeof(hostName)-1]='\0';
+    return 0!=gethostname(hostName, sizeof(hostName)-1) || host!=QString(hostName);
+}
+
+// QTCURVE_LOW_BANDWIDTH=1 (or 0) may be used to force low bandwidth mode on (or off)...
+static bool isLowBandwidthDisplay()
+{
+    const char *env=getenv("QTCURVE_LOW_BANDWIDTH");
+
+    return env ? 0!=atoi(env) : isRemoteDisplay();
+}
+
+// If QTCURVE_XRENDER=1, and Qt composites pixmaps that have an alpha channel via XRender, then gradients
+// with semi-transparent stops are cached as ARGB tiles and blended onto the background server side -
+// so that one tile serves all backgrounds. Likewise, the embedded images are composited through in
+// the required colour.
+static bool useXRender()
+{
+    static int use=-1;
+
+    if(-1==use)
+    {
+        const char *env=getenv("QTCURVE_XRENDER");
+
+        use=0;
+        if(env && 0!=atoi(env))
+        {
+            // Without XRender, Qt converts the alpha channel into a mask...
+            QImage img(1, 1, 32);
+
+            img.setAlphaBuffer(true);
+            img.setPixel(0, 0, qRgba(0, 0, 0, 128));
+            use=QPixmap(img).hasAlphaChannel() ? 1 : 0;
+        }
+    }
+
+    return 1==use;
+}
+
+static QString createKey(int size, int len, QRgb color, QRgb bgnd, bool horiz, int app, int tab, bool sel, QRgb selTab,
+                         bool argb)
 {
     QString key;
 
-    QTextOStream(&key) << size << '-' << color << '-' << bgnd << '-' << horiz << '-' << app << '-' << flags;
+    QTextOStream(&key) << size << '-' << len << '-' << color << '-' << bgnd << '-' << horiz << '-' << app << '-' << tab << '-'
+                       << sel << '-' << selTab << '-' << argb;
 
     return key;
 }
@@ -749,6 +820,24 @@ static QString createKey(QRgb color, char type='p')
     return key;
 }
 
+static QString createKey(QRgb color, char type, int adjust)
+{
+    QString key;
+
+    QTextOStream(&key) << type << adjust << '-' << color;
+
+    return key;
+}
+
+static QString createKey(char type, int serial, int sides, int titleHeight, QRgb bgnd)
+{
+    QString key;
+
+    QTextOStream(&key) << type << serial << '-' << sides << '-' << titleHeight << '-' << bgnd;
+
+    return key;
+}
+
 static QString createKey(QRgb color, EPixmap p)
 {
     QString key;
@@ -758,6 +847,95 @@ static QString createKey(QRgb color, EPixmap p)
     return key;
 }
 
+static QString createKey(QRgb color, int contrast, int highlight, bool custom)
+{
+    QString key;
+
+    QTextOStream(&key) << 'S' << color << '-' << contrast << '-' << highlight << '-' << custom;
+
+    return key;
+}
+
+static QString createKey(int size, bool horiz, int app, int w, int round, unsigned int flags, QRgb fill, QRgb bgnd,
+                         const QColor *cols, int roles, QRgb text, const QString &palette)
+{
+    QString key;
+
+    QTextOStream(&key) << 'B' << size << '-' << horiz << '-' << app << '-' << w << '-' << round << '-' << flags << '-'
+                       << fill << '-' << bgnd << '-' << cols[0].rgb() << '-' << cols[ORIGINAL_SHADE].rgb() << '-'
+                       << cols[STD_BORDER].rgb() << '-' << roles << '-' << text << '-' << palette;
+
+    return key;
+}
+
+static QString createKey(char type, int width, int height, unsigned int flags, bool noHover, QRgb bgnd, QRgb base,
+                         QRgb button, QRgb mark, QRgb hover, QRgb focus, const QString &palette)
+{
+    QString key;
+
+    QTextOStream(&key) << type << width << '-' << height << '-' << flags << '-' << noHover << '-' << bgnd << '-'
+                       << base << '-' << button << '-' << mark << '-' << hover << '-' << focus << '-' << palette;
+
+    return key;
+}
+
+// Given two renderings of the same item, the first onto black and the second onto white, mask out
+// of the first any pixel that the item did not paint. The mask is built client side, and sent as a
+// single image.
+static void maskUnpainted(QPixmap *pix, const QPixmap &alt)
+{
+    QImage a(pix->convertToImage().convertDepth(32)),
+           b(alt.convertToImage().convertDepth(32)),
+           mask(pix->width(), pix->height(), 1, 2, QImage::LittleEndian);
+    bool   masked(false);
+
+    mask.setColor(0, Qt::color0.rgb());
+    mask.setColor(1, Qt::color1.rgb());
+    mask.fill(1);
+
+    for(int y=0; y<a.height(); ++y)
+    {
+        const QRgb *la((const QRgb *)a.scanLine(y)),
+                   *lb((const QRgb *)b.scanLine(y));
+
+        for(int x=0; x<a.width(); ++x)
+            if(la[x]!=lb[x])
+            {
+                mask.setPixel(x, y, 0);
+                masked=true;
+            }
+    }
+
+    if(masked)
+    {
+        QBitmap bitmap;
+
+        bitmap.convertFromImage(mask, Qt::MonoOnly|Qt::ThresholdDither);
+        pix->setMask(bitmap);
+    }
+}
+
+static QString createKey(char type, bool horiz, int nLines, int step, int len, QRgb color)
+{
+    QString key;
+
+    QTextOStream(&key) << type << horiz << '-' << nLines << '-' << step << '-' << len << '-' << color;
+
+    return key;
+}
+
+// Length of the cached marker strips - a multiple of the dot spacing, so that they tile...
+#define MARKER_STRIP_LEN 192
+
+// Budget, in bytes, for the coloured copies of the embedded images...
+#define MAX_COLORED_IMAGE_COST 65536
+
+// Larger indicators are not cached...
+#define MAX_CACHED_INDICATOR_SIZE 32
+
+// Maximum number of interned shade sets to keep around when no longer in use...
+#define MAX_UNUSED_SHADES 16
+
 #ifdef SET_MDI_WINDOW_BUTTON_POSITIONS
 static void parseWindowLine(const QString &line, QValueList<int> &data)
 {
@@ -799,55 +977,185 @@ static bool isCheckBoxOfGroupBox(const QObject *w)
            !qstrcmp(w->name(), "qt_groupbox_checkbox");
 }
 
-static void drawArrow(QPainter *p, const QRect &r, const QColor &col, QStyle::PrimitiveElement pe, const Options &opts, bool small=false)
+// Arrows are drawn from monochrome glyphs, which are created on first use. These are drawn in
+// transparent mode, so that only the set bits are drawn - using the pen colour.
+#define ARROW_GLYPH_OFFSET 3
+#define ARROW_GLYPH_SIZE   ((ARROW_GLYPH_OFFSET*2)+1)
+
+static QBitmap *theArrowGlyphs[2][2][4];
+
+static void deleteArrowGlyphs()
+{
+    for(int v=0; v<2; ++v)
+        for(int s=0; s<2; ++s)
+            for(int d=0; d<4; ++d)
+            {
+                delete theArrowGlyphs[v][s][d];
+                theArrowGlyphs[v][s][d]=0L;
+            }
+}
+
+static void storeArrowGlyph(int v, int s, int d, QBitmap *glyph)
+{
+    static bool registered=false;
+
+    if(!registered)
+    {
+        qAddPostRoutine(deleteArrowGlyphs);
+        registered=true;
+    }
+
+    theArrowGlyphs[v][s][d]=glyph;
+}
+
+static QString arrowGlyphKey(int v, int s, int d)
+{
+    QString key;
+
+    QTextOStream(&key) << 'A' << v << '-' << s << '-' << d;
+
+    return key;
+}
+
+static QBitmap * arrowGlyph(QStyle::PrimitiveElement pe, bool vArrows, bool small)
 {
+    int dir(0);
+
+    switch(pe)
+    {
+        case QStyle::PE_ArrowUp:
+            dir=0;
+            break;
+        case QStyle::PE_ArrowDown:
+            dir=1;
+            break;
+        case QStyle::PE_ArrowRight:
+            dir=2;
+            break;
+        case QStyle::PE_ArrowLeft:
+            dir=3;
+            break;
+        default:
+            return 0L;
+    }
+
+    QBitmap *glyph(theArrowGlyphs[vArrows ? 1 : 0][small ? 1 : 0][dir]);
+
+    if(glyph)
+        return glyph;
+
     QPointArray a;
 
     if(small)
         switch(pe)
         {
             case QStyle::PE_ArrowUp:
-                a.setPoints(opts.vArrows ? 6 : 3,  2,0,  0,-2,  -2,0,   -2,1, 0,-1, 2,1);
+                a.setPoints(vArrows ? 6 : 3,  2,0,  0,-2,  -2,0,   -2,1, 0,-1, 2,1);
                 break;
             case QStyle::PE_ArrowDown:
-                a.setPoints(opts.vArrows ? 6 : 3,  2,0,  0,2,  -2,0,   -2,-1, 0,1, 2,-1);
+                a.setPoints(vArrows ? 6 : 3,  2,0,  0,2,  -2,0,   -2,-1, 0,1, 2,-1);
                 break;
             case QStyle::PE_ArrowRight:
-                a.setPoints(opts.vArrows ? 6 : 3,  0,-2,  2,0,  0,2,   -1,2, 1,0 -1,-2);
+                a.setPoints(vArrows ? 6 : 3,  0,-2,  2,0,  0,2,   -1,2, 1,0 -1,-2);
                 break;
             case QStyle::PE_ArrowLeft:
-                a.setPoints(opts.vArrows ? 6 : 3,  0,-2,  -2,0,  0,2,   1,2, -1,0, 1,-2);
+                a.setPoints(vArrows ? 6 : 3,  0,-2,  -2,0,  0,2,   1,2, -1,0, 1,-2);
                 break;
             default:
-                return;
+                return 0L;
         }
     else // Large arrows...
         switch(pe)
         {
             case QStyle::PE_ArrowUp:
-                a.setPoints(opts.vArrows ? 8 : 3,  3,1,  0,-2,  -3,1,    -3,2,  -2,2, 0,0,  2,2, 3,2);
+                a.setPoints(vArrows ? 8 : 3,  3,1,  0,-2,  -3,1,    -3,2,  -2,2, 0,0,  2,2, 3,2);
                 break;
             case QStyle::PE_ArrowDown:
-                a.setPoints(opts.vArrows ? 8 : 3,  3,-1,  0,2,  -3,-1,   -3,-2,  -2,-2, 0,0, 2,-2, 3,-2);
+                a.setPoints(vArrows ? 8 : 3,  3,-1,  0,2,  -3,-1,   -3,-2,  -2,-2, 0,0, 2,-2, 3,-2);
                 break;
             case QStyle::PE_ArrowRight:
-                a.setPoints(opts.vArrows ? 8 : 3,  -1,-3,  2,0,  -1,3,   -2,3, -2,2, 0,0, -2,-2, -2,-3);
+                a.setPoints(vArrows ? 8 : 3,  -1,-3,  2,0,  -1,3,   -2,3, -2,2, 0,0, -2,-2, -2,-3);
                 break;
             case QStyle::PE_ArrowLeft:
-                a.setPoints(opts.vArrows ? 8 : 3,  1,-3,  -2,0,  1,3,    2,3, 2,2, 0,0, 2,-2, 2,-3);
+                a.setPoints(vArrows ? 8 : 3,  1,-3,  -2,0,  1,3,    2,3, 2,2, 0,0, 2,-2, 2,-3);
                 break;
             default:
-                return;
+                return 0L;
         }
 
     if(a.isNull())
+        return 0L;
+
+    glyph=new QBitmap(ARROW_GLYPH_SIZE, ARROW_GLYPH_SIZE);
+    glyph->fill(Qt::color0);
+
+    QPainter painter(glyph);
+
+    a.translate(ARROW_GLYPH_OFFSET, ARROW_GLYPH_OFFSET);
+    painter.setBrush(Qt::color1);
+    painter.setPen(Qt::color1);
+    painter.drawPolygon(a);
+    painter.end();
+
+    storeArrowGlyph(vArrows ? 1 : 0, small ? 1 : 0, dir, glyph);
+    return glyph;
+}
+
+// The glyphs are stored in an atlas as opaque black, on transparent, images...
+static void loadArrowGlyphs(const Atlas *atlas)
+{
+    for(int v=0; v<2; ++v)
+        for(int s=0; s<2; ++s)
+            for(int d=0; d<4; ++d)
+            {
+                QImage img;
+
+                if(!theArrowGlyphs[v][s][d] && atlas->find(arrowGlyphKey(v, s, d), img))
+                {
+                    QBitmap *glyph=new QBitmap;
+
+                    glyph->convertFromImage(img.createAlphaMask(), Qt::MonoOnly|Qt::ThresholdDither);
+                    storeArrowGlyph(v, s, d, glyph);
+                }
+            }
+}
+
+static void recordArrowGlyphs(QMap<QString, QImage> &images)
+{
+    static const QStyle::PrimitiveElement constArrows[4]={ QStyle::PE_ArrowUp, QStyle::PE_ArrowDown,
+                                                           QStyle::PE_ArrowRight, QStyle::PE_ArrowLeft };
+
+    for(int v=0; v<2; ++v)
+        for(int s=0; s<2; ++s)
+            for(int d=0; d<4; ++d)
+            {
+                QBitmap *glyph(arrowGlyph(constArrows[d], v, s));
+
+                if(!glyph)
+                    continue;
+
+                QImage bits(glyph->convertToImage()),
+                       img(bits.width(), bits.height(), 32);
+
+                img.setAlphaBuffer(true);
+                for(int y=0; y<img.height(); ++y)
+                    for(int x=0; x<img.width(); ++x)
+                        img.setPixel(x, y, qGray(bits.pixel(x, y))<128 ? qRgba(0, 0, 0, 0xFF) : 0);
+                images[arrowGlyphKey(v, s, d)]=img;
+            }
+}
+
+static void drawArrow(QPainter *p, const QRect &r, const QColor &col, QStyle::PrimitiveElement pe, const Options &opts, bool small=false)
+{
+    QBitmap *glyph(arrowGlyph(pe, opts.vArrows, small));
+
+    if(!glyph)
         return;
 
     p->save();
-    a.translate((r.x()+(r.width()>>1)),(r.y()+(r.height()>>1)));
-    p->setBrush(col);
     p->setPen(col);
-    p->drawPolygon(a);
+    p->setBackgroundMode(Qt::TransparentMode);
+    p->drawPixmap(r.x()+(r.width()>>1)-ARROW_GLYPH_OFFSET, r.y()+(r.height()>>1)-ARROW_GLYPH_OFFSET, *glyph);
     p->restore();
 }
 
@@ -857,34 +1165,37 @@ QtCurveStyle::QtCurveStyle(const QString &name)
 QtCurveStyle::QtCurveStyle()
 #endif
             : BASE_STYLE(AllowMenuTransparency, WindowsStyleScrollBar),
-              itsPopupMenuCols(0L),
-              itsSliderCols(0L),
-              itsDefBtnCols(0L),
               itsMouseOverCols(0L),
-              itsComboBtnCols(0L),
-              itsCheckRadioSelCols(0L),
-              itsSortedLvColors(0L),
-              itsProgressCols(0L),
-              itsSidebarButtonsCols(0L),
+              itsMouseOverShades(0L),
+              itsResolvedShades(0),
               itsActiveMdiColors(0L),
               itsMdiColors(0L),
+              itsReadMdiColors(false),
               itsThemedApp(APP_OTHER),
-              itsPixmapCache(150000, 499),
+              itsPixmapCache(PIXMAP_CACHE_COST, 499),
+              itsColoredImageCache(MAX_COLORED_IMAGE_COST, 53),
+              itsSolidFill(0),
 #if defined QTC_QT_ONLY || !defined KDE_VERSION || KDE_VERSION >= 0x30200
               itsIsTransKicker(false),
 #endif
               itsHover(HOVER_NONE),
               itsOldPos(-1, -1),
-              itsFormMode(false),
               itsHoverWidget(0L),
               itsHoverSect(NO_SECT),
               itsHoverTab(0L),
               itsMactorPal(0L),
-              itsActive(true),
               itsIsSpecialHover(false),
               itsDragWidget(0L),
               itsDragWidgetHadMouseTracking(false),
-              itsShortcutHandler(new ShortcutHandler(this))
+              itsShortcutHandler(new ShortcutHandler(this)),
+              itsPaintFlash(PaintFlash::enabled() ? new PaintFlash(this) : 0L),
+              itsRepaintMonitor(RepaintMonitor::create(this)),
+              itsWindowProperties(new WindowProperties(this)),
+              itsLowBandwidth(isLowBandwidthDisplay()),
+              itsUploader(new ImageUploader(isRemoteDisplay())),
+              itsSharedPixmaps(SharedPixmaps::create()),
+              itsAtlas(0L),
+              itsWarmUp(WarmUp::enabled() ? new WarmUp(this) : 0L)
 {
 #ifdef QTC_STYLE_SUPPORT
     QString rcFile;
@@ -916,237 +1227,87 @@ QtCurveStyle::QtCurveStyle()
     if(opts.contrast<0 || opts.contrast>10)
         opts.contrast=DEFAULT_CONTRAST;
 
+    if(itsLowBandwidth)
+    {
+        // Each etch, glow, and animation frame costs several X requests - which is noticeable when the
+        // display is remote...
+        opts.buttonEffect=EFFECT_NONE;
+        opts.animatedProgress=false;
+        if(MO_GLOW==opts.coloredMouseOver)
+            opts.coloredMouseOver=MO_COLORED;
+        if(TAB_MO_GLOW==opts.tabMouseOver)
+            opts.tabMouseOver=TAB_MO_TOP;
+        if(FOCUS_GLOW==opts.focus)
+            opts.focus=FOCUS_FULL;
+        if(NULL!=getenv("QTCURVE_DEBUG"))
+            std::cout << "QtCurve: Using low bandwidth mode\n";
+    }
+
+    // Pre-rendered tiles, as created by qtcurve-atlas. When saving, the tiles generated by this
+    // process are recorded, and written out when the application is unpolished...
+    const char *atlasFile=getenv("QTCURVE_ATLAS_SAVE");
+
+    if(atlasFile)
+        itsAtlasFile=QString::fromLocal8Bit(atlasFile);
+    else if(NULL!=(atlasFile=getenv("QTCURVE_ATLAS")))
+    {
+        itsAtlas=Atlas::load(QString::fromLocal8Bit(atlasFile), atlasSignature());
+        if(itsAtlas)
+            loadArrowGlyphs(itsAtlas);
+        else if(NULL!=getenv("QTCURVE_DEBUG"))
+            std::cout << "QtCurve: Ignoring missing, corrupt, or out of date, atlas " << atlasFile << '\n';
+    }
+
     itsPixmapCache.setAutoDelete(true);
+    itsColoredImageCache.setAutoDelete(true);
 
     shadeColors(QApplication::palette().active().highlight(), itsHighlightCols);
     shadeColors(QApplication::palette().active().background(), itsBackgroundCols);
     shadeColors(QApplication::palette().active().button(), itsButtonCols);
 
+    for(int i=0; i<NUM_SHADE_SETS; ++i)
+        itsShadeSets[i]=0L;
+
     setDecorationColors(true);
 
-    switch(opts.shadeSliders)
-    {
-        default:
-        case SHADE_DARKEN:
-        case SHADE_NONE:
-            break;
-        case SHADE_SELECTED:
-            itsSliderCols=itsHighlightCols;
-            break;
-        case SHADE_BLEND_SELECTED:
-        case SHADE_CUSTOM:
-            if(!itsSliderCols)
-                itsSliderCols=new QColor [TOTAL_SHADES+1];
-            shadeColors(SHADE_BLEND_SELECTED==opts.shadeSliders
-                            ? midColor(itsHighlightCols[ORIGINAL_SHADE],
-                                       itsButtonCols[ORIGINAL_SHADE])
-                            : opts.customSlidersColor,
-                        itsSliderCols);
-    }
+    setMenuColors(QApplication::palette().active());
 
-    switch(opts.defBtnIndicator)
-    {
-        case IND_GLOW:
-        case IND_SELECTED:
-            itsDefBtnCols=itsHighlightCols;
-            break;
-        case IND_TINT:
-            itsDefBtnCols=new QColor [TOTAL_SHADES+1];
-            shadeColors(tint(itsButtonCols[ORIGINAL_SHADE],
-                            itsHighlightCols[ORIGINAL_SHADE], DEF_BNT_TINT), itsDefBtnCols);
-            break;
-        default:
-            break;
-        case IND_COLORED:
-            if(SHADE_BLEND_SELECTED==opts.shadeSliders)
-                itsDefBtnCols=itsSliderCols;
-            else
-            {
-                itsDefBtnCols=new QColor [TOTAL_SHADES+1];
-                shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE],
-                                    itsButtonCols[ORIGINAL_SHADE]), itsDefBtnCols);
-            }
-    }
-        
-    switch(opts.comboBtn)
+    if(SHADE_BLEND_SELECTED==opts.menuStripe)
+        opts.customMenuStripeColor=midColor(itsHighlightCols[ORIGINAL_SHADE],
+                                            popupMenuCols(QApplication::palette().active())[ORIGINAL_SHADE]);
+
+    // The window manager's colours may also adjust the options, so read these now - rather than
+    // when first painting...
+    if(SHADE_WINDOW_BORDER==opts.shadeMenubars)
     {
-        default:
-        case SHADE_DARKEN:
-        case SHADE_NONE:
-            break;
-        case SHADE_SELECTED:
-            itsComboBtnCols=itsHighlightCols;
-            break;
-        case SHADE_BLEND_SELECTED:
-            if(opts.shadeSliders==SHADE_BLEND_SELECTED)
-            {
-                itsComboBtnCols=itsSliderCols;
-                break;
-            }
-        case SHADE_CUSTOM:
-            if(opts.shadeSliders==SHADE_CUSTOM && opts.customSlidersColor==opts.customComboBtnColor)
-            {
-                itsComboBtnCols=itsSliderCols;
-                break;
-            }
-            if(!itsComboBtnCols)
-                itsComboBtnCols=new QColor [TOTAL_SHADES+1];
-            shadeColors(SHADE_BLEND_SELECTED==opts.comboBtn
-                            ? midColor(itsHighlightCols[ORIGINAL_SHADE],
-                                       itsButtonCols[ORIGINAL_SHADE])
-                            : opts.customComboBtnColor,
-                        itsComboBtnCols);
+        getMdiColors(QApplication::palette().active(), true);
+
+        if(opts.shadeMenubarOnlyWhenActive && itsActiveMdiColors && itsMdiColors &&
+           itsActiveMdiColors->cols[ORIGINAL_SHADE]==itsMdiColors->cols[ORIGINAL_SHADE])
+            opts.shadeMenubarOnlyWhenActive=false;
     }
 
-    switch(opts.sortedLv)
+    if ((SHADE_CUSTOM==opts.shadeMenubars || SHADE_BLEND_SELECTED==opts.shadeMenubars || SHADE_SELECTED==opts.shadeMenubars) &&
+        "soffice.bin"==QString(qApp->argv()[0]) && TOO_DARK(SHADE_CUSTOM==opts.shadeMenubars
+                                                       ? opts.customMenubarsColor
+                                                       : itsHighlightCols[ORIGINAL_SHADE]))
+        opts.shadeMenubars=SHADE_DARKEN;
+
+    switch(opts.shadeCheckRadio)
     {
-        case SHADE_DARKEN:
-            if(!itsSortedLvColors)
-                itsSortedLvColors=new QColor [TOTAL_SHADES+1];
-            shadeColors(shade(opts.lvButton ? itsButtonCols[ORIGINAL_SHADE] : itsBackgroundCols[ORIGINAL_SHADE], LV_HEADER_DARK_FACTOR), itsSortedLvColors);
-            break;
         default:
-        case SHADE_NONE:
+            itsCheckRadioCol=opts.crButton ? QApplication::palette().active().buttonText()
+                                           : QApplication::palette().active().text();
             break;
+        case SHADE_BLEND_SELECTED:
         case SHADE_SELECTED:
-            itsSortedLvColors=itsHighlightCols;
+            itsCheckRadioCol=QApplication::palette().active().highlight();
             break;
-        case SHADE_BLEND_SELECTED:
-            if(SHADE_BLEND_SELECTED==opts.shadeSliders)
-            {
-                itsSortedLvColors=itsSliderCols;
-                break;
-            }
-            else if(SHADE_BLEND_SELECTED==opts.comboBtn)
-            {
-                itsSortedLvColors=itsComboBtnCols;
-                break;
-            }
         case SHADE_CUSTOM:
-            if(opts.shadeSliders==SHADE_CUSTOM && opts.customSlidersColor==opts.customSortedLvColor)
-            {
-                itsSortedLvColors=itsSliderCols;
-                break;
-            }
-            if(opts.comboBtn==SHADE_CUSTOM && opts.customComboBtnColor==opts.customSortedLvColor)
-            {
-                itsSortedLvColors=itsComboBtnCols;
-                break;
-            }
-            if(!itsSortedLvColors)
-                itsSortedLvColors=new QColor [TOTAL_SHADES+1];
-            shadeColors(SHADE_BLEND_SELECTED==opts.sortedLv
-                            ? midColor(itsHighlightCols[ORIGINAL_SHADE],
-                                       (opts.lvButton ? itsButtonCols[ORIGINAL_SHADE] : itsBackgroundCols[ORIGINAL_SHADE]))
-                            : opts.customSortedLvColor,
-                        itsSortedLvColors);
+            itsCheckRadioCol=opts.customCheckRadioColor;
     }
 
-    switch(opts.crColor)
-    {
-        default:
-        case SHADE_NONE:
-            itsCheckRadioSelCols=itsButtonCols;
-            break;
-        case SHADE_DARKEN:
-            if(!itsCheckRadioSelCols)
-                itsCheckRadioSelCols=new QColor [TOTAL_SHADES+1];
-            shadeColors(shade(itsButtonCols[ORIGINAL_SHADE], LV_HEADER_DARK_FACTOR), itsCheckRadioSelCols);
-            break;
-        case SHADE_SELECTED:
-            itsCheckRadioSelCols=itsHighlightCols;
-            break;
-        case SHADE_CUSTOM:
-            if(SHADE_CUSTOM==opts.shadeSliders && opts.customSlidersColor==opts.customCrBgndColor)
-                itsCheckRadioSelCols=itsSliderCols;
-            else if(SHADE_CUSTOM==opts.comboBtn && opts.customComboBtnColor==opts.customCrBgndColor)
-                itsCheckRadioSelCols=itsComboBtnCols;
-            else if(SHADE_CUSTOM==opts.sortedLv && opts.customSortedLvColor==opts.customCrBgndColor)
-                itsCheckRadioSelCols=itsSortedLvColors;
-            else
-            {
-                if(!itsCheckRadioSelCols)
-                    itsCheckRadioSelCols=new QColor [TOTAL_SHADES+1];
-                shadeColors(opts.customCrBgndColor, itsCheckRadioSelCols);
-            }
-            break;
-        case SHADE_BLEND_SELECTED:
-            if(SHADE_BLEND_SELECTED==opts.shadeSliders)
-                itsCheckRadioSelCols=itsSliderCols;
-            else if(SHADE_BLEND_SELECTED==opts.comboBtn)
-                itsCheckRadioSelCols=itsComboBtnCols;
-            else if(SHADE_BLEND_SELECTED==opts.sortedLv)
-                itsCheckRadioSelCols=itsSortedLvColors;
-            else
-            {
-                if(!itsCheckRadioSelCols)
-                    itsCheckRadioSelCols=new QColor [TOTAL_SHADES+1];
-                shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), itsCheckRadioSelCols);
-            }
-    }
-
-    switch(opts.progressColor)
-    {
-        case SHADE_NONE:
-            itsProgressCols=itsBackgroundCols;
-            break;
-        default:
-            // Not set!
-            break;
-        case SHADE_CUSTOM:
-            if(SHADE_CUSTOM==opts.shadeSliders && opts.customSlidersColor==opts.customProgressColor)
-                itsProgressCols=itsSliderCols;
-            else if(SHADE_CUSTOM==opts.comboBtn && opts.customComboBtnColor==opts.customProgressColor)
-                itsProgressCols=itsComboBtnCols;
-            else if(SHADE_CUSTOM==opts.sortedLv && opts.customSortedLvColor==opts.customProgressColor)
-                itsProgressCols=itsSortedLvColors;
-            else if(SHADE_CUSTOM==opts.crColor && opts.customCrBgndColor==opts.customProgressColor)
-                itsProgressCols=itsCheckRadioSelCols;
-            else
-            {
-                if(!itsProgressCols)
-                    itsProgressCols=new QColor [TOTAL_SHADES+1];
-                shadeColors(opts.customProgressColor, itsProgressCols);
-            }
-            break;
-        case SHADE_BLEND_SELECTED:
-            if(SHADE_BLEND_SELECTED==opts.shadeSliders)
-                itsProgressCols=itsSliderCols;
-            else if(SHADE_BLEND_SELECTED==opts.comboBtn)
-                itsProgressCols=itsComboBtnCols;
-            else if(SHADE_BLEND_SELECTED==opts.sortedLv)
-                itsProgressCols=itsSortedLvColors;
-            else
-            {
-                if(!itsProgressCols)
-                    itsProgressCols=new QColor [TOTAL_SHADES+1];
-                shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsBackgroundCols[ORIGINAL_SHADE]), itsProgressCols);
-            }
-    }
-
-    setMenuColors(QApplication::palette().active());
-
-    if ((SHADE_CUSTOM==opts.shadeMenubars || SHADE_BLEND_SELECTED==opts.shadeMenubars || SHADE_SELECTED==opts.shadeMenubars) &&
-        "soffice.bin"==QString(qApp->argv()[0]) && TOO_DARK(SHADE_CUSTOM==opts.shadeMenubars
-                                                       ? opts.customMenubarsColor
-                                                       : itsHighlightCols[ORIGINAL_SHADE]))
-        opts.shadeMenubars=SHADE_DARKEN;
-
-    switch(opts.shadeCheckRadio)
-    {
-        default:
-            itsCheckRadioCol=opts.crButton ? QApplication::palette().active().buttonText()
-                                           : QApplication::palette().active().text();
-            break;
-        case SHADE_BLEND_SELECTED:
-        case SHADE_SELECTED:
-            itsCheckRadioCol=QApplication::palette().active().highlight();
-            break;
-        case SHADE_CUSTOM:
-            itsCheckRadioCol=opts.customCheckRadioColor;
-    }
-
-    if (opts.animatedProgress)
+    if (opts.animatedProgress)
     {
         itsAnimationTimer = new QTimer(this);
         connect(itsAnimationTimer, SIGNAL(timeout()), this, SLOT(updateProgressPos()));
@@ -1157,34 +1318,33 @@ QtCurveStyle::QtCurveStyle()
 
 QtCurveStyle::~QtCurveStyle()
 {
-    if(itsSidebarButtonsCols!=itsSliderCols && itsSidebarButtonsCols!=itsDefBtnCols)
-        delete [] itsSidebarButtonsCols;
-    if(itsPopupMenuCols && itsPopupMenuCols!=itsMenubarCols && itsPopupMenuCols!=itsBackgroundCols && itsPopupMenuCols!=itsActiveMdiColors)
-        delete [] itsPopupMenuCols;
-    if(itsActiveMdiColors && itsActiveMdiColors!=itsHighlightCols && itsActiveMdiColors!=itsBackgroundCols)
-        delete [] itsActiveMdiColors;
-    if(itsMdiColors && itsMdiColors!=itsBackgroundCols)
-        delete [] itsMdiColors;
-    if(itsMouseOverCols && itsMouseOverCols!=itsDefBtnCols &&
-       itsMouseOverCols!=itsSliderCols)
-        delete [] itsMouseOverCols;
-    if(itsDefBtnCols && itsDefBtnCols!=itsSliderCols && itsDefBtnCols!=itsFocusCols && itsDefBtnCols!=itsHighlightCols)
-        delete [] itsDefBtnCols;
-    if(itsProgressCols && itsProgressCols!=itsHighlightCols && itsProgressCols!=itsBackgroundCols &&
-       itsProgressCols!=itsSliderCols && itsProgressCols!=itsComboBtnCols && itsProgressCols!=itsCheckRadioSelCols &&  itsProgressCols!=itsSortedLvColors)
-        delete [] itsProgressCols;
-    if(itsCheckRadioSelCols && itsCheckRadioSelCols!=itsDefBtnCols && itsCheckRadioSelCols!=itsSliderCols &&
-       itsCheckRadioSelCols!=itsComboBtnCols && itsCheckRadioSelCols!=itsSortedLvColors &&
-       itsCheckRadioSelCols!=itsButtonCols && itsCheckRadioSelCols!=itsHighlightCols)
-        delete [] itsCheckRadioSelCols;
-    if(itsSortedLvColors && itsSortedLvColors!=itsHighlightCols && itsSortedLvColors!=itsSliderCols &&
-       itsSortedLvColors!=itsComboBtnCols)
-        delete [] itsSortedLvColors;
-    if(itsComboBtnCols && itsComboBtnCols!=itsHighlightCols && itsComboBtnCols!=itsSliderCols)
-        delete [] itsComboBtnCols;
-    if(itsSliderCols && itsSliderCols!=itsHighlightCols)
-        delete [] itsSliderCols;
+    // The warm-up thread reads the colour sets, so must be stopped first...
+    if(itsWarmUp)
+        itsWarmUp->stop();
+#ifdef QTC_USE_XRENDER
+    QMap<int, Qt::HANDLE>::Iterator mit(itsImageMasks.begin()),
+                                    mend(itsImageMasks.end());
+
+    for(; mit!=mend; ++mit)
+        if(mit.data())
+            XRenderFreePicture(qt_xdisplay(), mit.data());
+    if(itsSolidFill)
+        XRenderFreePicture(qt_xdisplay(), itsSolidFill);
+#endif
+    releaseShades();
+    releaseShades(itsActiveMdiColors);
+    releaseShades(itsMdiColors);
+    releaseShades(itsMouseOverShades);
+
+    QMap<QString, QtCShades *>::Iterator it(itsShadeStore.begin()),
+                                         end(itsShadeStore.end());
+
+    for(; it!=end; ++it)
+        delete it.data();
     delete itsMactorPal;
+    delete itsUploader;
+    delete itsSharedPixmaps;
+    delete itsAtlas;
 }
 
 static QString getFile(const QString &f)
@@ -1293,12 +1453,28 @@ void QtCurveStyle::polish(QApplication *app)
 //     BASE_STYLE::polish(app);
     if(opts.hideShortcutUnderline)
         addEventFilter(app, itsShortcutHandler);
+    if(itsPaintFlash)
+        addEventFilter(app, itsPaintFlash);
+    if(itsWarmUp)
+        startWarmUp();
 }
 
 void QtCurveStyle::unPolish(QApplication *app)
 {
     if(opts.hideShortcutUnderline)
         app->removeEventFilter(itsShortcutHandler);
+    if(itsPaintFlash)
+        app->removeEventFilter(itsPaintFlash);
+    if(itsWarmUp)
+        itsWarmUp->stop();
+    if(!itsAtlasFile.isEmpty())
+    {
+        recordArrowGlyphs(itsAtlasImages);
+        if(!Atlas::save(itsAtlasFile, atlasSignature(), itsAtlasImages))
+            std::cerr << "QtCurve: Failed to write atlas " << itsAtlasFile.local8Bit() << '\n';
+        else if(NULL!=getenv("QTCURVE_DEBUG"))
+            std::cout << "QtCurve: Wrote " << itsAtlasImages.count() << " tiles to " << itsAtlasFile.local8Bit() << '\n';
+    }
 //     BASE_STYLE::unPolish(app);
 }
 
@@ -1308,6 +1484,12 @@ void QtCurveStyle::polish(QPalette &pal)
        pal.active().background()!=itsMactorPal->active().background())
         return;
 
+    // The colour sets are about to be re-calculated - so stop any warm-up, and restart it afterwards...
+    bool warmUp(itsWarmUp && itsWarmUp->active());
+
+    if(warmUp)
+        itsWarmUp->stop();
+
     QSettings settings;
     int       contrast(settings.readNumEntry("/Qt/KDE/contrast", DEFAULT_CONTRAST));
     bool      newContrast(false);
@@ -1362,29 +1544,7 @@ void QtCurveStyle::polish(QPalette &pal)
          newGray(newContrast ||
                  itsBackgroundCols[ORIGINAL_SHADE]!=QApplication::palette().active().background()),
          newButton(newContrast ||
-                   itsButtonCols[ORIGINAL_SHADE]!=QApplication::palette().active().button()),
-         newSlider(itsSliderCols && SHADE_BLEND_SELECTED==opts.shadeSliders &&
-                   (newContrast || newButton || newMenu)),
-         newDefBtn(itsDefBtnCols && /*( (IND_COLORED==opts.defBtnIndicator &&*/
-                                       SHADE_BLEND_SELECTED!=opts.shadeSliders/*) ||*/
-                                      /*(IND_TINT==opts.defBtnIndicator) )*/ &&
-                   IND_SELECTED!=opts.defBtnIndicator && IND_GLOW!=opts.defBtnIndicator &&
-                   (newContrast || newButton || newMenu)),
-         newComboBtn(itsComboBtnCols && itsHighlightCols!=itsComboBtnCols && itsSliderCols!=itsComboBtnCols &&
-                     SHADE_BLEND_SELECTED==opts.comboBtn &&
-                     (newContrast || newButton || newMenu)),
-         newSortedLv(itsSortedLvColors && ( (SHADE_BLEND_SELECTED==opts.sortedLv && itsHighlightCols!=itsSortedLvColors && itsSliderCols!=itsSortedLvColors &&
-                                             itsComboBtnCols!=itsSortedLvColors) || 
-                                             SHADE_DARKEN==opts.sortedLv) &&
-                     (newContrast || (opts.lvButton ? newButton : newGray))),
-         newCheckRadioSelCols(itsCheckRadioSelCols && ( (SHADE_BLEND_SELECTED==opts.crColor && itsDefBtnCols!=itsCheckRadioSelCols &&
-                                                         itsSliderCols!=itsCheckRadioSelCols && itsComboBtnCols!=itsCheckRadioSelCols &&
-                                                         itsSortedLvColors!=itsCheckRadioSelCols) ||
-                                             SHADE_DARKEN==opts.crColor) &&
-                     (newContrast || newButton)),
-         newProgressCols(itsProgressCols && SHADE_BLEND_SELECTED==opts.progressColor &&
-                         itsSliderCols!=itsProgressCols && itsComboBtnCols!=itsProgressCols &&
-                         itsSortedLvColors!=itsProgressCols && itsCheckRadioSelCols!=itsProgressCols && (newContrast || newButton));
+                   itsButtonCols[ORIGINAL_SHADE]!=QApplication::palette().active().button());
 
     if(newGray)
         shadeColors(QApplication::palette().active().background(), itsBackgroundCols);
@@ -1399,40 +1559,14 @@ void QtCurveStyle::polish(QPalette &pal)
 
     setMenuColors(QApplication::palette().active());
 
-    if(newSlider)
-        shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), itsSliderCols);
-
-    if(newComboBtn)
-        shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), itsComboBtnCols);
-
-    if(newSortedLv)
-        if(SHADE_BLEND_SELECTED==opts.sortedLv)
-            shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE],
-                        opts.lvButton ? itsButtonCols[ORIGINAL_SHADE] : itsBackgroundCols[ORIGINAL_SHADE]), itsSortedLvColors);
-        else
-            shadeColors(shade(opts.lvButton ? itsButtonCols[ORIGINAL_SHADE] : itsBackgroundCols[ORIGINAL_SHADE], LV_HEADER_DARK_FACTOR), itsSortedLvColors);
-
-    if(newDefBtn)
-        if(IND_TINT==opts.defBtnIndicator)
-            shadeColors(tint(itsButtonCols[ORIGINAL_SHADE],
-                        itsHighlightCols[ORIGINAL_SHADE], DEF_BNT_TINT), itsDefBtnCols);
-        else if(IND_GLOW!=opts.defBtnIndicator)
-            shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE],
-                        itsButtonCols[ORIGINAL_SHADE]), itsDefBtnCols);
-
-    if(itsSidebarButtonsCols && SHADE_BLEND_SELECTED!=opts.shadeSliders &&
-       IND_COLORED!=opts.defBtnIndicator)
-        shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE],
-                   itsButtonCols[ORIGINAL_SHADE]), itsSidebarButtonsCols);
-
-    if(newCheckRadioSelCols)
-        if(SHADE_BLEND_SELECTED==opts.crColor)
-            shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), itsCheckRadioSelCols);
-        else
-            shadeColors(shade(itsButtonCols[ORIGINAL_SHADE], LV_HEADER_DARK_FACTOR), itsCheckRadioSelCols);
-
-    if(newProgressCols)
-        shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsBackgroundCols[ORIGINAL_SHADE]), itsProgressCols);
+    // Derived sets are re-resolved on next use...
+    if(newMenu || newGray || newButton)
+    {
+        releaseShades();
+        pruneShades();
+        // Cached bevels may have used any of the above...
+        updatePaletteKey();
+    }
 
     pal.setActive(setColorGroup(pal.active(), pal.active()));
     pal.setInactive(setColorGroup(pal.inactive(), pal.active()));
@@ -1454,41 +1588,59 @@ void QtCurveStyle::polish(QPalette &pal)
 
     if(itsMactorPal)
         *itsMactorPal=pal;
-    // Force this to be re-generated!
+    // The blended stripe colour depends upon the palette, so is calculated here - rather than
+    // whilst painting...
     if(SHADE_BLEND_SELECTED==opts.menuStripe)
-        opts.customMenuStripeColor=Qt::black;
+        opts.customMenuStripeColor=midColor(itsHighlightCols[ORIGINAL_SHADE],
+                                            popupMenuCols(pal.active())[ORIGINAL_SHADE]);
     
     if(APPEARANCE_STRIPED==opts.bgndAppearance)
-        pal.setBrush(QColorGroup::Background, QBrush(pal.active().background(), *createStripePixmap(pal.active().background(), true)));
+        pal.setBrush(QColorGroup::Background, QBrush(pal.active().background(), createStripePixmap(pal.active().background(), true)));
     else if(APPEARANCE_FILE==opts.bgndAppearance)
     {
-        QPixmap       pix(opts.bgndPixmap.img.width(), opts.bgndPixmap.img.height());
-        QPainter      p(&pix);
         WindowBorders borders=qtcGetWindowBorderSize();
-        int           xadjust=borders.sides>0 && borders.sides!=opts.bgndPixmap.img.width()
-                        ? borders.sides>opts.bgndPixmap.img.width()
-                            ? borders.sides%opts.bgndPixmap.img.width()
-                            : borders.sides
-                        :0,
-                      yadjust=borders.titleHeight>0 && borders.titleHeight!=opts.bgndPixmap.img.height()
-                        ? borders.titleHeight>opts.bgndPixmap.img.height()
-                            ? borders.titleHeight%opts.bgndPixmap.img.height()
-                            : borders.titleHeight
-                        :0;
-
-        p.fillRect(0, 0, opts.bgndPixmap.img.width(), opts.bgndPixmap.img.height(), pal.active().background());
-
-        p.drawPixmap(-xadjust, -yadjust, opts.bgndPixmap.img);
-        if(xadjust>0)
-            p.drawPixmap(opts.bgndPixmap.img.width()-xadjust, -yadjust, opts.bgndPixmap.img);
-        if(yadjust>0)
-            p.drawPixmap(-xadjust, opts.bgndPixmap.img.height()-yadjust, opts.bgndPixmap.img);
-        if(xadjust>0 && yadjust>0)
-            p.drawPixmap(opts.bgndPixmap.img.width()-xadjust,  opts.bgndPixmap.img.height()-yadjust, opts.bgndPixmap.img);
+        QString       key(createKey('W', opts.bgndPixmap.img.serialNumber(), borders.sides, borders.titleHeight,
+                                    pal.active().background().rgb()));
 
-        p.end();
-        pal.setBrush(QColorGroup::Background, QBrush(pal.active().background(), pix));
+        // Only re-compose the border-aligned tile if the image, borders, or colour have changed. This
+        // is kept outside of itsPixmapCache, as the image may well be larger than its budget...
+        if(key!=itsBgndTileKey)
+        {
+            int w(opts.bgndPixmap.img.width()),
+                h(opts.bgndPixmap.img.height()),
+                xadjust=borders.sides>0 && borders.sides!=w
+                    ? borders.sides>w
+                        ? borders.sides%w
+                        : borders.sides
+                    :0,
+                yadjust=borders.titleHeight>0 && borders.titleHeight!=h
+                    ? borders.titleHeight>h
+                        ? borders.titleHeight%h
+                        : borders.titleHeight
+                    :0;
+
+            itsBgndTile=QPixmap(w, h);
+            itsBgndTileKey=key;
+
+            QPainter p(&itsBgndTile);
+
+            p.fillRect(0, 0, w, h, pal.active().background());
+
+            p.drawPixmap(-xadjust, -yadjust, opts.bgndPixmap.img);
+            if(xadjust>0)
+                p.drawPixmap(w-xadjust, -yadjust, opts.bgndPixmap.img);
+            if(yadjust>0)
+                p.drawPixmap(-xadjust, h-yadjust, opts.bgndPixmap.img);
+            if(xadjust>0 && yadjust>0)
+                p.drawPixmap(w-xadjust, h-yadjust, opts.bgndPixmap.img);
+
+            p.end();
+        }
+        pal.setBrush(QColorGroup::Background, QBrush(pal.active().background(), itsBgndTile));
     }
+
+    if(warmUp)
+        startWarmUp();
 }
 
 static QColor disable(const QColor &col, const QColor &bgnd)
@@ -1998,21 +2150,18 @@ void QtCurveStyle::unPolish(QWidget *widget)
     BASE_STYLE::unPolish(widget);
 }
 
-static void sendXEvent(QDialog *dlg, const char *msg)
+static void sendXEvent(QDialog *dlg, EAtom msg)
 {
-    static Atom msgTypeAtom = XInternAtom(qt_xdisplay(), "_NET_WM_STATE", False);
-
     XEvent xev;
-    Atom   atom=XInternAtom(qt_xdisplay(), msg, False);
 
     xev.xclient.type = ClientMessage;
     xev.xclient.serial = 0;
     xev.xclient.send_event = True;
     xev.xclient.window = dlg->winId();
-    xev.xclient.message_type = msgTypeAtom;
+    xev.xclient.message_type = qtcAtom(ATOM_NET_WM_STATE);
     xev.xclient.format = 32;
     xev.xclient.data.l[0] = 1;
-    xev.xclient.data.l[1] = atom;
+    xev.xclient.data.l[1] = qtcAtom(msg);
     xev.xclient.data.l[2] = 0;
     xev.xclient.data.l[3] = 0;
     xev.xclient.data.l[4] = 0;
@@ -2124,7 +2273,7 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
             QColor   col(popupMenuCols(widget->palette().active())[ORIGINAL_SHADE]);
 
             if(APPEARANCE_STRIPED==opts.menuBgndAppearance)
-                painter.drawTiledPixmap(widget->rect(), *createStripePixmap(col, false));
+                painter.drawTiledPixmap(widget->rect(), createStripePixmap(col, false));
             else if(APPEARANCE_FILE==opts.menuBgndAppearance)
             {
                 painter.fillRect(widget->rect(), col);
@@ -2185,11 +2334,7 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
                 drawMenubar=true;
                 break;
             case QEvent::WindowActivate:
-                itsActive=true;
-                drawMenubar=opts.shadeMenubarOnlyWhenActive && SHADE_NONE!=opts.shadeMenubars;
-                break;
             case QEvent::WindowDeactivate:
-                itsActive=false;
                 drawMenubar=opts.shadeMenubarOnlyWhenActive && SHADE_NONE!=opts.shadeMenubars;
             default:
                 break;
@@ -2207,7 +2352,7 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
             r.setY(r.y()-y_offset);
             r.setHeight(parent->rect().height());
 
-            drawMenuOrToolBarBackground(&p, r, parent->colorGroup());
+            drawMenuOrToolBarBackground(&p, r, parent->colorGroup(), true, true, isActiveMenuBar(parent));
             return true;
         }
     }
@@ -2222,11 +2367,11 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
 
             if (::qt_cast<QSpinWidget*>(widget->parentWidget()))
             {
-                widget->parentWidget()->repaint(false);
+                repaintWidget(widget->parentWidget(), "focus");
                 return false;
             }
 
-            widget->repaint(false);
+            repaintWidget(widget, "focus");
         }
         return false;
     }
@@ -2272,12 +2417,8 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
             switch(event->type())
             {
                 case QEvent::WindowActivate:
-                    itsActive=true;
-                    ((QWidget *)object)->repaint(false);
-                    return false;
                 case QEvent::WindowDeactivate:
-                    itsActive=false;
-                    ((QWidget *)object)->repaint(false);
+                    repaintWidget((QWidget *)object, "menubar activation");
                     return false;
                 default:
                     break;
@@ -2341,6 +2482,10 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
     if(QEvent::PaletteChange==event->type() && (::qt_cast<QDialog *>(object) || ::qt_cast<QMainWindow *>(object)))
         setBgndProp(static_cast<QWidget *>(object), opts.bgndAppearance);
 
+    // Make sure the window decoration can read the properties as soon as the window is mapped...
+    if(QEvent::Show==event->type() && (::qt_cast<QDialog *>(object) || ::qt_cast<QMainWindow *>(object)))
+        itsWindowProperties->flush(static_cast<QWidget *>(object));
+
 #ifdef QTC_ENABLE_PARENTLESS_DIALOG_FIX_SUPPORT
     if(opts.fixParentlessDialogs && ::qt_cast<QDialog *>(object))
     {
@@ -2362,10 +2507,10 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
                 {
                     // OO.o's filepicker is a spawned process - but is not set transient :-(
                     // --plus no reliable way of finding which widget to make it transient for...
-                    sendXEvent(dlg, "_NET_WM_STATE_SKIP_PAGER");
-                    sendXEvent(dlg, "_NET_WM_STATE_SKIP_TASKBAR");
-                    sendXEvent(dlg, "_NET_WM_STATE_ABOVE");
-                    sendXEvent(dlg, "_NET_WM_STATE_STAYS_ON_TOP");
+                    sendXEvent(dlg, ATOM_NET_WM_STATE_SKIP_PAGER);
+                    sendXEvent(dlg, ATOM_NET_WM_STATE_SKIP_TASKBAR);
+                    sendXEvent(dlg, ATOM_NET_WM_STATE_ABOVE);
+                    sendXEvent(dlg, ATOM_NET_WM_STATE_STAYS_ON_TOP);
                     //setActions(dlg);
                 }
                 break;
@@ -2429,14 +2574,14 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
         case QEvent::FocusIn:
         case QEvent::FocusOut:
             if(opts.highlightScrollViews && object->isWidgetType() && ::qt_cast<QScrollView*>(object))
-                ((QWidget *)object)->repaint(false);
+                repaintWidget((QWidget *)object, "focus");
             break;
         case QEvent::Hide:
         case QEvent::Show:
             if(::qt_cast<QListBox *>(object) &&
               (((QListBox *)object)->parentWidget() &&
                ::qt_cast<QComboBox *>(((QListBox *)object)->parentWidget())))
-                ((QComboBox *)(((QListBox *)object)->parentWidget()))->repaint(false);
+                repaintWidget(((QListBox *)object)->parentWidget(), "combo popup");
 //             else if(::qt_cast<QFrame *>(object) &&
 //                (QFrame::Box==((QFrame *)object)->frameShape() || QFrame::Panel==((QFrame *)object)->frameShape() ||
 //                 QFrame::WinPanel==((QFrame *)object)->frameShape()))
@@ -2452,15 +2597,12 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
                     if(::qt_cast<QTabBar*>(object) && static_cast<QWidget*>(object)->isEnabled())
                     {
                         itsHoverTab=0L;
-                        itsHoverWidget->repaint(false);
-                    }
-                    else if(!itsHoverWidget->hasMouseTracking() || (itsFormMode=isFormWidget(itsHoverWidget)))
-                    {
-                        itsHoverWidget->repaint(false);
-                        itsFormMode=false;
+                        repaintWidget(itsHoverWidget, "hover", !itsLowBandwidth);
                     }
+                    else if(!itsHoverWidget->hasMouseTracking() || isFormWidget(itsHoverWidget))
+                        repaintWidget(itsHoverWidget, "hover", !itsLowBandwidth);
                     else if(opts.highlightScrollViews && ::qt_cast<QScrollView *>(itsHoverWidget))
-                        itsHoverWidget->repaint(false);
+                        repaintWidget(itsHoverWidget, "hover", !itsLowBandwidth);
                 }
                 else
                     itsHoverWidget=0L;
@@ -2473,7 +2615,7 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
             if(itsHoverWidget && object==itsHoverWidget)
             {
                 resetHover();
-                ((QWidget *)object)->repaint(false);
+                repaintWidget((QWidget *)object, "hover", !itsLowBandwidth);
             }
             break;
         case QEvent::MouseMove:  // Only occurs for widgets with mouse tracking enabled
@@ -2483,7 +2625,7 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
             if(me && itsHoverWidget && object->isWidgetType())
             {
                 if(!me->pos().isNull() && itsIsSpecialHover && redrawHoverWidget(me->pos()))
-                    itsHoverWidget->repaint(false);
+                    repaintWidget(itsHoverWidget, "hover", !itsLowBandwidth);
                 itsOldPos=me->pos();
             }
             break;
@@ -2498,11 +2640,136 @@ bool QtCurveStyle::eventFilter(QObject *object, QEvent *event)
 void QtCurveStyle::drawLightBevel(const QColor &bgnd, QPainter *p, const QRect &rOrig, const QColorGroup &cg, SFlags flags, int round,
                                   const QColor &fill, const QColor *custom, bool doBorder, bool doCorners, EWidget w, const QWidget *widget) const
 {
+    QTC_PROFILE(CAT_LIGHT_BEVEL, w, widget, p);
+
     EAppearance  app(qtcWidgetApp(APPEARANCE_NONE!=opts.tbarBtnAppearance &&
                                (WIDGET_TOOLBAR_BUTTON==w || (WIDGET_BUTTON(w) && isOnToolbar(widget, p)))
                                 ? WIDGET_TOOLBAR_BUTTON : w, &opts));
-    QRect        r(rOrig),
-                 br(r);
+    QRect        r(rOrig);
+    bool         sunken(flags &(Style_Down|Style_On|Style_Sunken)),
+                 doEtch(!(flags&FORM_WIDGET) && doBorder && ETCH_WIDGET(w) && !(flags&CHECK_BUTTON) &&
+                        DO_EFFECT),
+                 glowFocus(doEtch && USE_GLOW_FOCUS(flags&Style_MouseOver) && flags&Style_HasFocus && flags&Style_Enabled),
+                 sunkenToggleMo(sunken && !(flags&Style_Down) && flags&(Style_MouseOver|TOGGLE_BUTTON));
+
+    p->save();
+
+    if(doEtch)
+        r.addCoords(1, 1, -1, -1);
+
+    if(!drawLightBevelCached(bgnd, p, r, cg, flags, round, fill, custom, doBorder, doCorners, w, app, doEtch, glowFocus))
+        drawLightBevelReal(bgnd, p, r, cg, flags, round, fill, custom, doBorder, doCorners, w, app, doEtch, glowFocus);
+
+    if(doEtch || glowFocus)
+        if( (!sunken  || sunkenToggleMo) && !(opts.thin&THIN_FRAMES) &&
+            ((WIDGET_OTHER!=w && WIDGET_SLIDER_TROUGH!=w && MO_GLOW==opts.coloredMouseOver && flags&Style_MouseOver) ||
+             glowFocus ||
+             (WIDGET_DEF_BUTTON==w && IND_GLOW==opts.defBtnIndicator)/* ||
+              (flags&Style_HasFocus && FOCUS_FULL==opts.focus)*/ ))
+            drawGlow(p, rOrig, cg, WIDGET_DEF_BUTTON==w && flags&Style_MouseOver ? WIDGET_STD_BUTTON : w,
+                     glowFocus ? itsFocusCols : 0);
+        else
+            drawEtch(p, rOrig, cg, EFFECT_SHADOW==opts.buttonEffect && WIDGET_BUTTON(w) && !sunken, ROUNDED_NONE==round, w);
+
+    p->restore();
+}
+
+// Width (or height) of the end caps of a cached bevel. Everything that is not uniform along the length
+// of a bevel (rounded corners, the ends of the light/3d/mouse-over lines) lies within this many pixels
+// of its ends.
+#define BEVEL_CAP_SIZE         4
+// Bevels thicker than this are not cached...
+#define MAX_CACHED_BEVEL_SIZE  128
+// Length of the pixmap that a bevel is drawn into, before being split into its caps and tile...
+#define BEVEL_PIXMAP_LEN       QMAX(2*BEVEL_CAP_SIZE+PIXMAP_DIMENSION, MIN_ROUND_FULL_SIZE)
+
+bool QtCurveStyle::drawLightBevelCached(const QColor &bgnd, QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags,
+                                        int round, const QColor &fill, const QColor *custom, bool doBorder, bool doCorners,
+                                        EWidget w, EAppearance app, bool doEtch, bool glowFocus) const
+{
+    bool horiz(flags&Style_Horizontal);
+    int  len(horiz ? r.width() : r.height()),
+         size(horiz ? r.height() : r.width());
+
+    // Only bevels that paint every pixel of their rect can be cached, otherwise the pixmaps would need
+    // masks - and masked blits are slower than the lines they would replace. Form mode (KHTML) draws the
+    // corners using pixmaps, progressbars may be striped, and the plastik slider mouse-over depends upon
+    // the length of the slider.
+    if((flags&FORM_WIDGET) || !doBorder || !doCorners || WIDGET_PROGRESSBAR==w ||
+       (WIDGET_SB_SLIDER==w && MO_PLASTIK==opts.coloredMouseOver && flags&Style_MouseOver) ||
+       len<QMAX(2*BEVEL_CAP_SIZE+1, MIN_ROUND_FULL_SIZE) || size<3 || size>MAX_CACHED_BEVEL_SIZE)
+        return false;
+
+    const QColor *cols(custom ? custom : itsBackgroundCols);
+    int          roles((cols==itsFocusCols ? 1 : 0)|(cols==itsMouseOverCols ? 2 : 0)|(cols==comboBtnCols() ? 4 : 0));
+    QString      key(createKey(size, horiz, app, w, round, flags, fill.rgb(), bgnd.rgb(), cols, roles,
+                               cg.buttonText().rgb(), itsPaletteKey)),
+                 tileKey(key+'m');
+    QPixmap      *caps(itsPixmapCache.find(key)),
+                 *tile(itsPixmapCache.find(tileKey));
+
+    if(!caps || !tile)
+    {
+        itsPixmapCache.remove(key);
+        itsPixmapCache.remove(tileKey);
+        caps=new QPixmap;
+        tile=new QPixmap;
+
+        if(!findTile(*caps, key) || !findTile(*tile, tileKey))
+        {
+            int     pixLen(BEVEL_PIXMAP_LEN);
+            QPixmap pix(horiz ? pixLen : size, horiz ? size : pixLen);
+            QPainter pixPainter(&pix);
+
+            drawLightBevelReal(bgnd, &pixPainter, pix.rect(), cg, flags, round, fill, custom, doBorder, doCorners, w, app,
+                               doEtch, glowFocus);
+            pixPainter.end();
+
+            if(horiz)
+            {
+                caps->resize(2*BEVEL_CAP_SIZE, size);
+                tile->resize(PIXMAP_DIMENSION, size);
+                bitBlt(caps, 0, 0, &pix, 0, 0, BEVEL_CAP_SIZE, size);
+                bitBlt(caps, BEVEL_CAP_SIZE, 0, &pix, pixLen-BEVEL_CAP_SIZE, 0, BEVEL_CAP_SIZE, size);
+                bitBlt(tile, 0, 0, &pix, BEVEL_CAP_SIZE, 0, PIXMAP_DIMENSION, size);
+            }
+            else
+            {
+                caps->resize(size, 2*BEVEL_CAP_SIZE);
+                tile->resize(size, PIXMAP_DIMENSION);
+                bitBlt(caps, 0, 0, &pix, 0, 0, size, BEVEL_CAP_SIZE);
+                bitBlt(caps, 0, BEVEL_CAP_SIZE, &pix, 0, pixLen-BEVEL_CAP_SIZE, size, BEVEL_CAP_SIZE);
+                bitBlt(tile, 0, 0, &pix, 0, BEVEL_CAP_SIZE, size, PIXMAP_DIMENSION);
+            }
+            recordTile(key, *caps);
+            recordTile(tileKey, *tile);
+        }
+
+        itsPixmapCache.insert(key, caps, caps->width()*caps->height()*(caps->depth()/8));
+        itsPixmapCache.insert(tileKey, tile, tile->width()*tile->height()*(tile->depth()/8));
+    }
+
+    if(horiz)
+    {
+        p->drawPixmap(r.x(), r.y(), *caps, 0, 0, BEVEL_CAP_SIZE, size);
+        p->drawTiledPixmap(r.x()+BEVEL_CAP_SIZE, r.y(), len-(2*BEVEL_CAP_SIZE), size, *tile);
+        p->drawPixmap(r.x()+len-BEVEL_CAP_SIZE, r.y(), *caps, BEVEL_CAP_SIZE, 0, BEVEL_CAP_SIZE, size);
+    }
+    else
+    {
+        p->drawPixmap(r.x(), r.y(), *caps, 0, 0, size, BEVEL_CAP_SIZE);
+        p->drawTiledPixmap(r.x(), r.y()+BEVEL_CAP_SIZE, size, len-(2*BEVEL_CAP_SIZE), *tile);
+        p->drawPixmap(r.x(), r.y()+len-BEVEL_CAP_SIZE, *caps, 0, BEVEL_CAP_SIZE, size, BEVEL_CAP_SIZE);
+    }
+
+    return true;
+}
+
+void QtCurveStyle::drawLightBevelReal(const QColor &bgnd, QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags,
+                                      int round, const QColor &fill, const QColor *custom, bool doBorder, bool doCorners,
+                                      EWidget w, EAppearance app, bool doEtch, bool glowFocus) const
+{
+    QRect        br(r);
     bool         bevelledButton(WIDGET_BUTTON(w) && APPEARANCE_BEVELLED==app),
                  sunken(flags &(Style_Down|Style_On|Style_Sunken)),
                  flatWidget(WIDGET_PROGRESSBAR==w && !opts.borderProgress),
@@ -2519,23 +2786,12 @@ void QtCurveStyle::drawLightBevel(const QColor &bgnd, QPainter *p, const QRect &
                  plastikMouseOver(doColouredMouseOver && MO_PLASTIK==opts.coloredMouseOver),
                  colouredMouseOver(doColouredMouseOver &&
                                        (MO_COLORED==opts.coloredMouseOver || MO_COLORED_THICK==opts.coloredMouseOver ||
-                                        (MO_GLOW==opts.coloredMouseOver && itsFormMode))),
-                 doEtch(!itsFormMode && doBorder && ETCH_WIDGET(w) && !(flags&CHECK_BUTTON) &&
-                        DO_EFFECT),
-                 glowFocus(doEtch && USE_GLOW_FOCUS(flags&Style_MouseOver) && flags&Style_HasFocus && flags&Style_Enabled),
+                                        (MO_GLOW==opts.coloredMouseOver && (flags&FORM_WIDGET)))),
                  sunkenToggleMo(sunken && !(flags&Style_Down) && flags&(Style_MouseOver|TOGGLE_BUTTON)),
                  horiz(flags&Style_Horizontal);
     const QColor *cols(custom ? custom : itsBackgroundCols),
                  *border(colouredMouseOver ? borderColors(flags, cols) : cols);
 
-    p->save();
-
-    if(doEtch)
-    {
-        r.addCoords(1, 1, -1, -1);
-        br=r;
-    }
-
     // fill
     if(br.width()>0 && br.height()>0)
     {
@@ -2682,7 +2938,7 @@ void QtCurveStyle::drawLightBevel(const QColor &bgnd, QPainter *p, const QRect &
         const QColor *borderCols=glowFocus ||
                                  (WIDGET_COMBO==w && USE_GLOW_FOCUS(flags&Style_MouseOver) && flags&Style_HasFocus && flags&Style_Enabled)
                         ? itsFocusCols
-                        : (WIDGET_COMBO==w || WIDGET_COMBO_BUTTON==w) && cols==itsComboBtnCols
+                        : (WIDGET_COMBO==w || WIDGET_COMBO_BUTTON==w) && cols==comboBtnCols()
                             ? flags&Style_MouseOver && MO_GLOW==opts.coloredMouseOver && !sunken
                                 ? itsMouseOverCols
                                 : itsButtonCols
@@ -2695,37 +2951,26 @@ void QtCurveStyle::drawLightBevel(const QColor &bgnd, QPainter *p, const QRect &
             drawBorder(bgnd, p, r, cg, flags, round,
                         WIDGET_DEF_BUTTON==w && IND_GLOW==opts.defBtnIndicator &&
                         (!(flags&Style_MouseOver) || !itsMouseOverCols)
-                            ? itsDefBtnCols : itsMouseOverCols, w, doCorners);
+                            ? defBtnCols() : itsMouseOverCols, w, doCorners);
         else
             drawBorder(bgnd, p, r, cg, flags, round,
                        colouredMouseOver && MO_COLORED_THICK==opts.coloredMouseOver ? itsMouseOverCols : borderCols,
                        w, doCorners);
     }
-
-    if(doEtch || glowFocus)
-        if( (!sunken  || sunkenToggleMo) && !(opts.thin&THIN_FRAMES) &&
-            ((WIDGET_OTHER!=w && WIDGET_SLIDER_TROUGH!=w && MO_GLOW==opts.coloredMouseOver && flags&Style_MouseOver) ||
-             glowFocus ||
-             (WIDGET_DEF_BUTTON==w && IND_GLOW==opts.defBtnIndicator)/* ||
-              (flags&Style_HasFocus && FOCUS_FULL==opts.focus)*/ ))
-            drawGlow(p, rOrig, cg, WIDGET_DEF_BUTTON==w && flags&Style_MouseOver ? WIDGET_STD_BUTTON : w,
-                     glowFocus ? itsFocusCols : 0);
-        else
-            drawEtch(p, rOrig, cg, EFFECT_SHADOW==opts.buttonEffect && WIDGET_BUTTON(w) && !sunken, ROUNDED_NONE==round, w);
-
-    p->restore();
 }
 
 void QtCurveStyle::drawGlow(QPainter *p, const QRect &r, const QColorGroup &cg, EWidget w, const QColor *cols) const
 {
-    if(itsMouseOverCols || itsDefBtnCols || cols)
+    const QColor *defCols(defBtnCols());
+
+    if(itsMouseOverCols || defCols || cols)
     {
         bool   def(WIDGET_DEF_BUTTON==w && IND_GLOW==opts.defBtnIndicator),
-               defShade=def && (!itsDefBtnCols ||
-                                (itsMouseOverCols && itsDefBtnCols[ORIGINAL_SHADE]==itsMouseOverCols[ORIGINAL_SHADE]));
+               defShade=def && (!defCols ||
+                                (itsMouseOverCols && defCols[ORIGINAL_SHADE]==itsMouseOverCols[ORIGINAL_SHADE]));
         QColor col(cols ? cols[GLOW_MO]
-                        : (def && itsDefBtnCols) || !itsMouseOverCols
-                            ? itsDefBtnCols[GLOW_DEFBTN] : itsMouseOverCols[GLOW_MO]);
+                        : (def && defCols) || !itsMouseOverCols
+                            ? defCols[GLOW_DEFBTN] : itsMouseOverCols[GLOW_MO]);
 
         col=midColorF(cg.background(), col, 1.5-GLOW_ALPHA(defShade));
         p->setPen(col);
@@ -2791,10 +3036,14 @@ void QtCurveStyle::drawEtch(QPainter *p, const QRect &r, const QColorGroup &cg,
     }
 }
 
+#define LOW_BANDWIDTH_CORNER_REQUESTS 15
+
 void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, const QColorGroup &cg,
                               SFlags flags, int round, const QColor *custom, EWidget w, bool doCorners,
                               EBorder borderProfile, bool blendBorderColors, int borderVal) const
 {
+    QTC_PROFILE(CAT_BORDER, w, 0L, p);
+
     EAppearance  app(qtcWidgetApp(w, &opts));
     const QColor *cols(custom ? custom : itsBackgroundCols);
     QColor       border(flags&Style_ButtonDefault && IND_FONT_COLOR==opts.defBtnIndicator &&
@@ -2850,16 +3099,20 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                 p->drawLine(r.x()+1, r.y()+r.height()-2, r.x()+r.width()-2, r.y()+r.height()-2);
         }
 
-    if(ROUNDED && ROUNDED_NONE!=round)
+    // The anti-aliased corners need around 16 requests, whereas a square border needs only 1...
+    if(itsLowBandwidth && ROUNDED && ROUNDED_NONE!=round)
+        QTC_COUNT("low bandwidth: X requests saved", LOW_BANDWIDTH_CORNER_REQUESTS);
+
+    if(ROUNDED && ROUNDED_NONE!=round && !itsLowBandwidth)
     {
         bool largeArc(WIDGET_FOCUS!=w && FULLLY_ROUNDED && !(flags&CHECK_BUTTON) &&
                       r.width()>=MIN_ROUND_FULL_SIZE && r.height()>=MIN_ROUND_FULL_SIZE &&
                       !(flags&DW_CLOSE_BUTTON) && (WIDGET_PROGRESSBAR!=w || opts.fillProgress));
 
         p->setPen(border);
-        if(itsFormMode)
+        if(flags&FORM_WIDGET)
         {
-            // If we're itsFormMode (KHTML) then we need to draw the aa borders using pixmaps
+            // If we're drawing a FORM_WIDGET (KHTML) then we need to draw the aa borders using pixmaps
             //  - so we need to draw 2 pixels away from each corner (so that the alpha
             // blend lets through the background color...
             p->drawLine(r.x()+2, r.y(), r.x()+r.width()-3, r.y());
@@ -2891,7 +3144,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
         }
         else
         {
-            // If we're not itsFormMode (ie. not KHTML) then we can just draw 1 pixel in - as
+            // If we're not drawing a FORM_WIDGET (ie. not KHTML) then we can just draw 1 pixel in - as
             // we can overwrite with the alpha colour.
             p->drawLine(r.x()+1, r.y(), r.x()+r.width()-2, r.y());
             p->drawLine(r.x()+1, r.y()+r.height()-1, r.x()+r.width()-2, r.y()+r.height()-1);
@@ -2903,14 +3156,14 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
         {
             QColor  largeArcMid(midColor(border, bgnd)),
                     aaColor(midColor(custom ? custom[3] : itsBackgroundCols[3], bgnd));
-            QPixmap *pix=itsFormMode ? getPixelPixmap(border) : 0L;
+            QPixmap *pix=(flags&FORM_WIDGET) ? getPixelPixmap(border) : 0L;
 
             if(round&CORNER_TL)
             {
                 if(largeArc)
                 {
                     p->drawPoint(r.x()+1, r.y()+1);
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         p->drawPixmap(r.x(), r.y()+1, *pix);
                         p->drawPixmap(r.x()+1, r.y(), *pix);
@@ -2922,7 +3175,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                     }
                 }
                 if(doCorners)
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         if(!largeArc)
                             p->drawPixmap(r.x(), r.y(), *pix);
@@ -2942,7 +3195,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                 if(largeArc)
                 {
                     p->drawPoint(r.x()+r.width()-2, r.y()+1);
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         p->drawPixmap(r.x()+r.width()-2, r.y(), *pix);
                         p->drawPixmap(r.x()+r.width()-1, r.y()+1, *pix);
@@ -2954,7 +3207,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                     }
                 }
                 if(doCorners)
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         if(!largeArc)
                             p->drawPixmap(r.x()+r.width()-1, r.y(), *pix);
@@ -2974,7 +3227,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                 if(largeArc)
                 {
                     p->drawPoint(r.x()+r.width()-2, r.y()+r.height()-2);
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         p->drawPixmap(r.x()+r.width()-2, r.y()+r.height()-1, *pix);
                         p->drawPixmap(r.x()+r.width()-1, r.y()+r.height()-2, *pix);
@@ -2987,7 +3240,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                     }
                 }
                 if(doCorners)
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         if(!largeArc)
                             p->drawPixmap(r.x()+r.width()-1, r.y()+r.height()-1, *pix);
@@ -3007,7 +3260,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                 if(largeArc)
                 {
                     p->drawPoint(r.x()+1, r.y()+r.height()-2);
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         p->drawPixmap(r.x(), r.y()+r.height()-2, *pix);
                         p->drawPixmap(r.x()+1, r.y()+r.height()-1, *pix);
@@ -3019,7 +3272,7 @@ void QtCurveStyle::drawBorder(const QColor &bgnd, QPainter *p, const QRect &r, c
                     }
                 }
                 if(doCorners)
-                    if(itsFormMode)
+                    if(flags&FORM_WIDGET)
                     {
                         if(!largeArc)
                             p->drawPixmap(r.x(), r.y()+r.height()-1, *pix);
@@ -3142,7 +3395,7 @@ void QtCurveStyle::drawEntryField(QPainter *p, const QRect &rx, const QColorGrou
                             ? itsFocusCols
                             : backgroundColors(cg));
     bool         isSpin(WIDGET_SPIN==w),
-                 doEtch(!itsFormMode && opts.etchEntry && (!isSpin || opts.unifySpin) && WIDGET_COMBO!=w && DO_EFFECT),
+                 doEtch(!(flags&FORM_WIDGET) && opts.etchEntry && (!isSpin || opts.unifySpin) && WIDGET_COMBO!=w && DO_EFFECT),
                  reverse(QApplication::reverseLayout());
 
     if(WIDGET_SCROLLVIEW!=w && (opts.square&SQUARE_ENTRY))
@@ -3153,7 +3406,7 @@ void QtCurveStyle::drawEntryField(QPainter *p, const QRect &rx, const QColorGrou
     if(doEtch)
         r.addCoords(1, 1, -1, -1);
 
-    if(!itsFormMode)
+    if(!(flags&FORM_WIDGET))
     {
         p->setPen(cg.background());
         p->drawRect(rx);
@@ -3204,9 +3457,278 @@ void QtCurveStyle::drawArrow(QPainter *p, const QRect &r, const QColorGroup &cg,
     ::drawArrow(p, r, p->pen()==QPen::NoPen ? col : p->pen().color(), pe, opts, small);
 }
 
+void QtCurveStyle::drawCheckBox(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags) const
+{
+    bool   doEtch(DO_EFFECT && !(flags&FORM_WIDGET) && !(flags&LISTVIEW_ITEM)),
+           on(flags&Style_On || !(flags&Style_Off)),
+           sunken(flags&Style_Down);
+    QRect  rect(doEtch ? QRect(r.x()+1, r.y()+1, r.width()-2, r.height()-2) : r);
+    SFlags sflags(!(flags&Style_Off) ? flags|Style_On : flags);
+
+    if(sunken || (!(flags&FORM_WIDGET) && HOVER_NONE==itsHover))
+        sflags&=~Style_MouseOver;
+
+    bool  glowFocus(USE_GLOW_FOCUS(flags&Style_MouseOver) && sflags&Style_Enabled && sflags&Style_HasFocus),
+          glow(doEtch && sflags&Style_Enabled && ((MO_GLOW==opts.coloredMouseOver && sflags&Style_MouseOver) || glowFocus));
+    const QColor *bc(glowFocus ? itsFocusCols : borderColors(sflags, 0L)),
+                 *btn(checkRadioColors(cg, sflags)),
+                 *use(bc ? bc : btn),
+                 &bgnd(opts.crButton
+                        ? getFill(flags, btn, true)
+                        : sflags&Style_Enabled && !sunken
+                            ? MO_NONE==opts.coloredMouseOver && !opts.crHighlight && sflags&Style_MouseOver
+                                ? use[CR_MO_FILL]
+                                : cg.base()
+                            : cg.background());
+    EWidget      wid=opts.crButton ? WIDGET_STD_BUTTON : WIDGET_TROUGH;
+    EAppearance  app=opts.crButton ? opts.appearance : APPEARANCE_INVERTED;
+    bool         drawSunken=opts.crButton ? sunken : false,
+                 lightBorder=DRAW_LIGHT_BORDER(drawSunken, wid, app),
+                 draw3dFull=!lightBorder && DRAW_3D_FULL_BORDER(drawSunken, app),
+                 draw3d=draw3dFull || (!lightBorder && DRAW_3D_BORDER(drawSunken, app)),
+                 drawLight=opts.crButton && !drawSunken && (lightBorder || draw3d),
+                 drawDark=drawLight && draw3dFull && !lightBorder;
+
+    if(IS_FLAT(opts.appearance))
+        p->fillRect(QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2), bgnd);
+    else
+        drawBevelGradient(bgnd, bgnd, p, QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2), true,
+                          drawSunken, app, wid);
+
+    if(MO_NONE!=opts.coloredMouseOver && !glow && sflags&Style_MouseOver && sflags&Style_Enabled)
+    {
+        p->setPen(use[CR_MO_FILL]);
+        p->drawRect(QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2));
+        // p->drawRect(QRect(rect.x()+2, rect.y()+2, rect.width()-4, rect.height()-4));
+    }
+    else if(!opts.crButton || drawLight)
+    {
+        p->setPen(drawLight ? btn[LIGHT_BORDER(app)] : midColor(sflags&Style_Enabled ? cg.base() : cg.background(), use[3]));
+        if(lightBorder)
+            p->drawRect(QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2));
+        else
+        {
+            p->drawLine(rect.x()+1, rect.y()+1, rect.x()+1, rect.y()+rect.height()-2);
+            p->drawLine(rect.x()+1, rect.y()+1, rect.x()+rect.width()-2, rect.y()+1);
+
+            if(drawDark)
+            {
+                p->setPen(btn[2]);
+                p->drawLine(rect.x()+rect.width()-2, rect.y()+1,
+                            rect.x()+rect.width()-2, rect.y()+rect.height()-2);
+                p->drawLine(rect.x()+1, rect.y()+rect.height()-2,
+                            rect.x()+rect.width()-2, rect.y()+rect.height()-2);
+            }
+        }
+    }
+
+    drawBorder(cg.background(), p, rect, cg, (SFlags)(sflags|Style_Horizontal|CHECK_BUTTON),
+               ROUNDED_ALL, use, WIDGET_OTHER, !(flags&LISTVIEW_ITEM));
+
+    if(doEtch)
+    {
+        QColor topCol(glow
+                        ? glowFocus ? itsFocusCols[GLOW_MO] : itsMouseOverCols[GLOW_MO]
+                        : shade(cg.background(), ETCHED_DARK)),
+               botCol(glow
+                        ? topCol
+                        : itsBackgroundCols[1]);
+
+        p->setBrush(Qt::NoBrush);
+        p->setPen(topCol);
+        if(!opts.crButton || EFFECT_SHADOW!=opts.buttonEffect || drawSunken || glow)
+        {
+            p->drawLine(r.x()+1, r.y(), r.x()+r.width()-2, r.y());
+            p->drawLine(r.x(), r.y()+1, r.x(), r.y()+r.height()-2);
+            p->setPen(botCol);
+        }
+        p->drawLine(r.x()+1, r.y()+r.height()-1, r.x()+r.width()-2, r.y()+r.height()-1);
+        p->drawLine(r.x()+r.width()-1, r.y()+1, r.x()+r.width()-1, r.y()+r.height()-2);
+    }
+
+    if(on)
+        drawPrimitive(PE_CheckMark, p, rect, cg, flags);
+}
+
+void QtCurveStyle::drawRadioButton(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags) const
+{
+    bool  doEtch(DO_EFFECT && !(flags&FORM_WIDGET)),
+          sunken(flags&Style_Down);
+    QRect rect(doEtch ? QRect(r.x()+1, r.y()+1, r.width()-2, r.height()-2) : r);
+    int   x(rect.x()), y(rect.y());
+
+    QPointArray clipRegion;
+
+    clipRegion.setPoints(8,  x,    y+8,     x,    y+4,     x+4, y,      x+8, y,
+                             x+12, y+4,     x+12, y+8,     x+8, y+12,   x+4, y+12);
+
+    SFlags sflags(flags);
+
+    if(sunken || (!(flags&FORM_WIDGET) && HOVER_NONE==itsHover))
+        sflags&=~Style_MouseOver;
+
+    bool         glowFocus(USE_GLOW_FOCUS(flags&Style_MouseOver) && sflags&Style_Enabled && sflags&Style_HasFocus),
+                 glow(doEtch && sflags&Style_Enabled && ((MO_GLOW==opts.coloredMouseOver && sflags&Style_MouseOver) ||
+                                                         glowFocus)),
+                 set(sflags&Style_On),
+                 coloredMo(MO_NONE!=opts.coloredMouseOver && !glow &&
+                           sflags&Style_MouseOver && sflags&Style_Enabled);
+    const QColor *bc(glowFocus ? itsFocusCols : borderColors(sflags, 0L)),
+                 *btn(checkRadioColors(cg, sflags)),
+                 *use(bc ? bc : btn);
+    const QColor &on(checkRadioCol(flags, cg)),
+                 &bgnd(opts.crButton
+                        ? getFill(flags, btn, true)
+                        : sflags&Style_Enabled && !sunken
+                            ? MO_NONE==opts.coloredMouseOver && !opts.crHighlight && sflags&Style_MouseOver
+                                ? use[CR_MO_FILL]
+                                : cg.base()
+                            : cg.background());
+    EWidget      wid=opts.crButton ? WIDGET_STD_BUTTON : WIDGET_TROUGH;
+    EAppearance  app=opts.crButton ? opts.appearance : APPEARANCE_INVERTED;
+    bool         drawSunken=opts.crButton ? sunken : EFFECT_NONE!=opts.buttonEffect,
+                 lightBorder=DRAW_LIGHT_BORDER(drawSunken, wid, app),
+                 draw3d=!lightBorder &&
+                        (DRAW_3D_BORDER(drawSunken, app) || DRAW_3D_FULL_BORDER(drawSunken, app)),
+                 drawLight=opts.crButton && !drawSunken && (lightBorder || draw3d),
+                 doneShadow=false;
+
+    p->save();
+
+    if(opts.crHighlight && sflags&Style_MouseOver)
+        drawBevelGradient(shade(cg.background(), TO_FACTOR(opts.crHighlight)), cg.background(), p, r, true,
+                          false, opts.selectionAppearance, WIDGET_SELECTION);
+    else
+        p->fillRect(r, cg.background());
+
+    if(doEtch && !glow && opts.crButton && !drawSunken && EFFECT_SHADOW==opts.buttonEffect)
+    {
+        p->setBrush(Qt::NoBrush);
+        p->setPen(shade(cg.background(), ETCHED_DARK));
+        p->drawArc(QRect(r.x(), r.y(), opts.crSize, opts.crSize), 225*16, 180*16);
+        doneShadow=true;
+    }
+
+    p->setClipRegion(QRegion(clipRegion));
+    if(IS_FLAT(opts.appearance))
+        p->fillRect(QRect(x+1, y+1, rect.width()-2, rect.height()-2), bgnd);
+    else
+        drawBevelGradient(bgnd, bgnd, p, QRect(x+1, y+1, rect.width()-2, rect.height()-2), true,
+                          drawSunken, app, wid);
+
+    if(coloredMo)
+    {
+        p->setPen(use[CR_MO_FILL]);
+        p->drawArc(QRect(x+1, y+1, opts.crSize-2, opts.crSize-2), 0, 360*16);
+//         p->drawArc(QRect(x+2, y+2, opts.crSize-4, opts.crSize-4), 0, 360*16);
+//         p->drawArc(QRect(x+3, y+3, opts.crSize-6, opts.crSize-6), 0, 360*16);
+        p->drawPoint(x+2, y+4);
+        p->drawPoint(x+4, y+2);
+        p->drawPoint(x+8, y+2);
+        p->drawPoint(x+10, y+4);
+        p->drawPoint(x+2, y+8);
+        p->drawPoint(x+4, y+10);
+        p->drawPoint(x+8, y+10);
+        p->drawPoint(x+10, y+8);
+    }
+
+    p->setClipping(false);
+
+    if(doEtch && !doneShadow)
+    {
+        QColor topCol(glow
+                        ? glowFocus ? itsFocusCols[GLOW_MO] : itsMouseOverCols[GLOW_MO]
+                        : shade(cg.background(), ETCHED_DARK)),
+               botCol(glow
+                        ? topCol
+                        : itsBackgroundCols[1]);
+
+        p->setBrush(Qt::NoBrush);
+        p->setPen(topCol);
+        if(drawSunken || glow)
+        {
+            p->drawArc(QRect(r.x(), r.y(), opts.crSize, opts.crSize), 45*16, 180*16);
+            p->setPen(botCol);
+        }
+        p->drawArc(QRect(r.x(), r.y(), opts.crSize, opts.crSize), 225*16, 180*16);
+    }
+
+    drawImage(p, rect.x(), rect.y(), use[BORDER_VAL(flags&Style_Enabled)], PIX_RADIO_BORDER, 0.8);
+
+    if(QApplication::NormalColor!=QApplication::colorSpec() || (flags&FORM_WIDGET))
+    {
+        p->setPen(QPen(use[opts.coloredMouseOver && sflags&Style_MouseOver ? 4 : BORDER_VAL(flags&Style_Enabled)], 1));
+        p->drawArc(rect, 0, 5760);
+    }
+
+    if(set)
+        drawImage(p, rect.x(), rect.y(), on, PIX_RADIO_ON);
+    if(!coloredMo && (!opts.crButton || drawLight) && (QApplication::NormalColor==QApplication::colorSpec() || (flags&FORM_WIDGET)))
+        drawImage(p, rect.x(), rect.y(), btn[drawLight ? LIGHT_BORDER(app) : (sflags&Style_MouseOver ? 3 : 4)],
+                  lightBorder ? PIX_RADIO_INNER : PIX_RADIO_LIGHT);
+    p->restore();
+}
+
+// Check and radio indicators are a fixed size, so they are cached fully composited. The etching may
+// leave some pixels untouched, and these are masked out.
+bool QtCurveStyle::drawCachedIndicator(PrimitiveElement pe, QPainter *p, const QRect &r, const QColorGroup &cg,
+                                       SFlags flags) const
+{
+    if((flags&FORM_WIDGET) || r.width()<1 || r.height()<1 ||
+       r.width()>MAX_CACHED_INDICATOR_SIZE || r.height()>MAX_CACHED_INDICATOR_SIZE)
+        return false;
+
+    QString key(createKey(PE_Indicator==pe ? 'I' : 'R', r.width(), r.height(), flags, HOVER_NONE==itsHover,
+                          cg.background().rgb(), cg.base().rgb(), cg.button().rgb(),
+                          checkRadioCol(flags, cg).rgb(), itsMouseOverCols ? itsMouseOverCols[ORIGINAL_SHADE].rgb() : 0,
+                          itsFocusCols[ORIGINAL_SHADE].rgb(), itsPaletteKey));
+    QPixmap *pix(itsPixmapCache.find(key));
+
+    if(!pix)
+    {
+        pix=new QPixmap;
+
+        if(!findTile(*pix, key))
+        {
+            QRect   pr(0, 0, r.width(), r.height());
+            QPixmap alt(pr.width(), pr.height());
+
+            pix->resize(pr.width(), pr.height());
+            for(int i=0; i<2; ++i)
+            {
+                QPixmap *dest(i ? &alt : pix);
+
+                dest->fill(i ? Qt::white : Qt::black);
+
+                QPainter pixPainter(dest);
+
+                if(PE_Indicator==pe)
+                    drawCheckBox(&pixPainter, pr, cg, flags);
+                else
+                    drawRadioButton(&pixPainter, pr, cg, flags);
+                pixPainter.end();
+            }
+            maskUnpainted(pix, alt);
+            recordTile(key, *pix);
+        }
+        itsPixmapCache.insert(key, pix, pix->width()*pix->height()*(pix->depth()/8));
+    }
+
+    p->drawPixmap(r.x(), r.y(), *pix);
+    return true;
+}
+
 void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &r,
                                  const QColorGroup &cg, SFlags flags, const QStyleOption &data) const
 {
+    QTC_PROFILE(CAT_PRIMITIVE, pe, 0L, p);
+    QTC_RECORD(CAT_PRIMITIVE, pe, 0L, p, r, cg, flags, 0, 0, data);
+    PaintFlashGuard flash(itsPaintFlash, p, r, 0L);
+
+    if(p && p->device() && QInternal::Widget==p->device()->devType() &&
+       isFormWidget((const QWidget *)p->device()))
+        flags|=FORM_WIDGET;
+
     switch(pe)
     {
         case PE_HeaderSection:
@@ -3225,13 +3747,11 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                 if(HOVER_KICKER==itsHover && itsHoverWidget) //  && itsHoverWidget==p->device())
                     flags|=Style_MouseOver;
 #endif
-                itsFormMode=itsIsTransKicker;
+                if(itsIsTransKicker)
+                    flags|=FORM_WIDGET;
 #endif
                 drawLightBevel(p, r, cg, flags|Style_Horizontal, ROUNDED_ALL,
                                getFill(flags, use), use, true, false);
-#if defined QTC_QT_ONLY || !defined KDE_VERSION || KDE_VERSION >= 0x30200
-                itsFormMode=false;
-#endif
             }
             else
             {
@@ -3269,8 +3789,8 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                     break;
                 }
 
-                const QColor *use(flags&Style_Enabled && itsSortedLvColors && isSort
-                                    ? itsSortedLvColors
+                const QColor *use(flags&Style_Enabled && sortedLvCols() && isSort
+                                    ? sortedLvCols()
                                     : opts.lvButton ? buttonColors(cg) : backgroundColors(cg));
                 
                 flags=((flags|Style_Sunken)^Style_Sunken)| Style_Raised;
@@ -3344,7 +3864,7 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
         case PE_ButtonDropDown:
         {
             const QColor *use((IND_TINT==opts.defBtnIndicator || IND_SELECTED==opts.defBtnIndicator) && flags&Style_Enabled && flags&Style_ButtonDefault
-                                ? itsDefBtnCols : buttonColors(cg));
+                                ? defBtnCols() : buttonColors(cg));
             bool         glassMod(PE_ButtonTool==pe && IS_GLASS(opts.appearance) &&
                                   IS_GLASS(opts.toolbarAppearance)),
                          mdi(!(flags&CHECK_BUTTON) && (!(flags&STD_TOOLBUTTON)||flags&NO_ETCH_BUTTON) &&
@@ -3362,12 +3882,10 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                     flags-=Style_Horizontal;
             }
 
-            // Dont AA' MDI windows' control buttons...
-            itsFormMode=itsFormMode || mdi || operaMdi;
-
             if(mdi || operaMdi)
             {
-                flags|=Style_Horizontal;
+                // Dont AA' MDI windows' control buttons...
+                flags|=Style_Horizontal|FORM_WIDGET;
                 if(!operaMdi)
                 {
                     if(flags<0x14000000 && !(flags&(Style_Down|Style_On|Style_Sunken|Style_MouseOver)))
@@ -3401,7 +3919,7 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                 QRegion outer(r);
                 QRect   r2(r);
 
-                if(!itsFormMode && DO_EFFECT)
+                if(!(flags&FORM_WIDGET) && DO_EFFECT)
                     r2.addCoords(1, 1, -1, -1);
 
                 r2.addCoords(COLORED_BORDER_SIZE, COLORED_BORDER_SIZE, -COLORED_BORDER_SIZE,
@@ -3417,11 +3935,10 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                                  || (APP_KORN==itsThemedApp && itsIsTransKicker && PE_ButtonTool==pe)
 #endif
                                     ? ROUNDED_NONE : ROUNDED_ALL,
-                               itsDefBtnCols[MO_DEF_BTN], itsDefBtnCols, true, true,
+                               defBtnCols()[MO_DEF_BTN], defBtnCols(), true, true,
                                WIDGET_DEF_BUTTON);
                 p->setClipping(false);
             }
-            itsFormMode=false;
             break;
         }
 
@@ -3451,10 +3968,10 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
         case PE_CheckMark:
             if(flags&Style_On)
             {
-                QPixmap *pix(getPixmap(checkRadioCol(flags, cg), PIX_CHECK, 1.0));
+                const QtCImage &img(constImages[pixmapImage(PIX_CHECK, opts)]);
 
-                p->drawPixmap(r.center().x()-(pix->width()/2), r.center().y()-(pix->height()/2),
-                              *pix);
+                drawImage(p, r.center().x()-(img.width/2), r.center().y()-(img.height/2),
+                          checkRadioCol(flags, cg), PIX_CHECK);
             }
             else if (!(flags&Style_Off))    // tri-state
             {
@@ -3476,9 +3993,9 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                              *use(bc ? bc : btn);
                 int          x(r.x()+1), y(r.y()+2);
 
-                p->drawPixmap(x, y, *getPixmap(use[opts.coloredMouseOver && flags&Style_MouseOver
-                                                    ? 4 : BORDER_VAL(flags&Style_Enabled)],
-                                               PIX_RADIO_BORDER, 0.8));
+                drawImage(p, x, y, use[opts.coloredMouseOver && flags&Style_MouseOver
+                                            ? 4 : BORDER_VAL(flags&Style_Enabled)],
+                          PIX_RADIO_BORDER, 0.8);
                 ::drawArrow(p, QRect(r.x()-1, r.y()-1, r.width(), r.height()),
                             use[opts.coloredMouseOver && flags&Style_MouseOver ? 4:5], PE_ArrowDown, opts);
             }
@@ -3529,115 +4046,26 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                 p->fillRect(r, color1);
             break;
         case PE_Indicator:
+            if(!drawCachedIndicator(pe, p, r, cg, flags))
+                drawCheckBox(p, r, cg, flags);
+            break;
+        case PE_CheckListExclusiveIndicator:
         {
-            bool   doEtch(DO_EFFECT && !itsFormMode && !(flags&LISTVIEW_ITEM)),
-                   on(flags&Style_On || !(flags&Style_Off)),
-                   sunken(flags&Style_Down);
-            QRect  rect(doEtch ? QRect(r.x()+1, r.y()+1, r.width()-2, r.height()-2) : r);
-            SFlags sflags(!(flags&Style_Off) ? flags|Style_On : flags);
-
-            if(sunken || (!itsFormMode && HOVER_NONE==itsHover))
-                sflags&=~Style_MouseOver;
-
-            bool  glowFocus(USE_GLOW_FOCUS(flags&Style_MouseOver) && sflags&Style_Enabled && sflags&Style_HasFocus),
-                  glow(doEtch && sflags&Style_Enabled && ((MO_GLOW==opts.coloredMouseOver && sflags&Style_MouseOver) || glowFocus));
-            const QColor *bc(glowFocus ? itsFocusCols : borderColors(sflags, 0L)),
-                         *btn(checkRadioColors(cg, sflags)),
-                         *use(bc ? bc : btn),
-                         &bgnd(opts.crButton
-                                ? getFill(flags, btn, true)
-                                : sflags&Style_Enabled && !sunken
-                                    ? MO_NONE==opts.coloredMouseOver && !opts.crHighlight && sflags&Style_MouseOver
-                                        ? use[CR_MO_FILL]
-                                        : cg.base()
-                                    : cg.background());
-            EWidget      wid=opts.crButton ? WIDGET_STD_BUTTON : WIDGET_TROUGH;
-            EAppearance  app=opts.crButton ? opts.appearance : APPEARANCE_INVERTED;
-            bool         drawSunken=opts.crButton ? sunken : false,
-                         lightBorder=DRAW_LIGHT_BORDER(drawSunken, wid, app),
-                         draw3dFull=!lightBorder && DRAW_3D_FULL_BORDER(drawSunken, app),
-                         draw3d=draw3dFull || (!lightBorder && DRAW_3D_BORDER(drawSunken, app)),
-                         drawLight=opts.crButton && !drawSunken && (lightBorder || draw3d),
-                         drawDark=drawLight && draw3dFull && !lightBorder;
-
-            if(IS_FLAT(opts.appearance))
-                p->fillRect(QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2), bgnd);
-            else
-                drawBevelGradient(bgnd, bgnd, p, QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2), true,
-                                  drawSunken, app, wid);
+            QCheckListItem *item(data.checkListItem());
 
-            if(MO_NONE!=opts.coloredMouseOver && !glow && sflags&Style_MouseOver && sflags&Style_Enabled)
-            {
-                p->setPen(use[CR_MO_FILL]);
-                p->drawRect(QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2));
-                // p->drawRect(QRect(rect.x()+2, rect.y()+2, rect.width()-4, rect.height()-4));
-            }
-            else if(!opts.crButton || drawLight)
+            if(item)
             {
-                p->setPen(drawLight ? btn[LIGHT_BORDER(app)] : midColor(sflags&Style_Enabled ? cg.base() : cg.background(), use[3]));
-                if(lightBorder)
-                    p->drawRect(QRect(rect.x()+1, rect.y()+1, rect.width()-2, rect.height()-2));
-                else
-                {
-                    p->drawLine(rect.x()+1, rect.y()+1, rect.x()+1, rect.y()+rect.height()-2);
-                    p->drawLine(rect.x()+1, rect.y()+1, rect.x()+rect.width()-2, rect.y()+1);
+                const QColor *bc(borderColors(flags, 0L)),
+                             *btn(buttonColors(cg)),
+                             *use(bc ? bc : btn),
+                             &on(checkRadioCol(flags, cg));
+                int          x(r.x()), y(r.y()+2);
 
-                    if(drawDark)
-                    {
-                        p->setPen(btn[2]);
-                        p->drawLine(rect.x()+rect.width()-2, rect.y()+1,
-                                    rect.x()+rect.width()-2, rect.y()+rect.height()-2);
-                        p->drawLine(rect.x()+1, rect.y()+rect.height()-2,
-                                    rect.x()+rect.width()-2, rect.y()+rect.height()-2);
-                    }
-                }
-            }
-
-            drawBorder(cg.background(), p, rect, cg, (SFlags)(sflags|Style_Horizontal|CHECK_BUTTON),
-                       ROUNDED_ALL, use, WIDGET_OTHER, !(flags&LISTVIEW_ITEM));
-
-            if(doEtch)
-            {
-                QColor topCol(glow
-                                ? glowFocus ? itsFocusCols[GLOW_MO] : itsMouseOverCols[GLOW_MO]
-                                : shade(cg.background(), ETCHED_DARK)),
-                       botCol(glow
-                                ? topCol
-                                : itsBackgroundCols[1]);
-
-                p->setBrush(Qt::NoBrush);
-                p->setPen(topCol);
-                if(!opts.crButton || EFFECT_SHADOW!=opts.buttonEffect || drawSunken || glow)
-                {
-                    p->drawLine(r.x()+1, r.y(), r.x()+r.width()-2, r.y());
-                    p->drawLine(r.x(), r.y()+1, r.x(), r.y()+r.height()-2);
-                    p->setPen(botCol);
-                }
-                p->drawLine(r.x()+1, r.y()+r.height()-1, r.x()+r.width()-2, r.y()+r.height()-1);
-                p->drawLine(r.x()+r.width()-1, r.y()+1, r.x()+r.width()-1, r.y()+r.height()-2);
-            }
-
-            if(on)
-                drawPrimitive(PE_CheckMark, p, rect, cg, flags);
-            break;
-        }
-        case PE_CheckListExclusiveIndicator:
-        {
-            QCheckListItem *item(data.checkListItem());
-
-            if(item)
-            {
-                const QColor *bc(borderColors(flags, 0L)),
-                             *btn(buttonColors(cg)),
-                             *use(bc ? bc : btn),
-                             &on(checkRadioCol(flags, cg));
-                int          x(r.x()), y(r.y()+2);
-
-                p->drawPixmap(x, y, *getPixmap(use[opts.coloredMouseOver && flags&Style_MouseOver ? 4 : BORDER_VAL(flags&Style_Enabled)],
-                                               PIX_RADIO_BORDER, 0.8));
+                drawImage(p, x, y, use[opts.coloredMouseOver && flags&Style_MouseOver ? 4 : BORDER_VAL(flags&Style_Enabled)],
+                          PIX_RADIO_BORDER, 0.8);
 
                 if(flags&Style_On)
-                    p->drawPixmap(x, y, *getPixmap(on, PIX_RADIO_ON, 1.0));
+                    drawImage(p, x, y, on, PIX_RADIO_ON);
             }
             break;
         }
@@ -3650,127 +4078,8 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                 p->setBrush(Qt::color1);
                 p->drawPie(r, 0, 5760);
             }
-            else
-            {
-                bool  doEtch(DO_EFFECT && !itsFormMode),
-                      sunken(flags&Style_Down);
-                QRect rect(doEtch ? QRect(r.x()+1, r.y()+1, r.width()-2, r.height()-2) : r);
-                int   x(rect.x()), y(rect.y());
-
-                QPointArray clipRegion;
-
-                clipRegion.setPoints(8,  x,    y+8,     x,    y+4,     x+4, y,      x+8, y,
-                                         x+12, y+4,     x+12, y+8,     x+8, y+12,   x+4, y+12);
-
-                SFlags sflags(flags);
-
-                if(sunken || (!itsFormMode && HOVER_NONE==itsHover))
-                    sflags&=~Style_MouseOver;
-
-                bool         glowFocus(USE_GLOW_FOCUS(flags&Style_MouseOver) && sflags&Style_Enabled && sflags&Style_HasFocus),
-                             glow(doEtch && sflags&Style_Enabled && ((MO_GLOW==opts.coloredMouseOver && sflags&Style_MouseOver) ||
-                                                                     glowFocus)),
-                             set(sflags&Style_On),
-                             coloredMo(MO_NONE!=opts.coloredMouseOver && !glow &&
-                                       sflags&Style_MouseOver && sflags&Style_Enabled);
-                const QColor *bc(glowFocus ? itsFocusCols : borderColors(sflags, 0L)),
-                             *btn(checkRadioColors(cg, sflags)),
-                             *use(bc ? bc : btn);
-                const QColor &on(checkRadioCol(flags, cg)),
-                             &bgnd(opts.crButton
-                                    ? getFill(flags, btn, true)
-                                    : sflags&Style_Enabled && !sunken
-                                        ? MO_NONE==opts.coloredMouseOver && !opts.crHighlight && sflags&Style_MouseOver
-                                            ? use[CR_MO_FILL]
-                                            : cg.base()
-                                        : cg.background());
-                EWidget      wid=opts.crButton ? WIDGET_STD_BUTTON : WIDGET_TROUGH;
-                EAppearance  app=opts.crButton ? opts.appearance : APPEARANCE_INVERTED;
-                bool         drawSunken=opts.crButton ? sunken : EFFECT_NONE!=opts.buttonEffect,
-                             lightBorder=DRAW_LIGHT_BORDER(drawSunken, wid, app),
-                             draw3d=!lightBorder &&
-                                    (DRAW_3D_BORDER(drawSunken, app) || DRAW_3D_FULL_BORDER(drawSunken, app)),
-                             drawLight=opts.crButton && !drawSunken && (lightBorder || draw3d),
-                             doneShadow=false;
-
-                p->save();
-
-                if(opts.crHighlight && sflags&Style_MouseOver)
-                    drawBevelGradient(shade(cg.background(), TO_FACTOR(opts.crHighlight)), cg.background(), p, r, true,
-                                      false, opts.selectionAppearance, WIDGET_SELECTION);
-                else
-                    p->fillRect(r, cg.background());
-
-                if(doEtch && !glow && opts.crButton && !drawSunken && EFFECT_SHADOW==opts.buttonEffect)
-                {
-                    p->setBrush(Qt::NoBrush);
-                    p->setPen(shade(cg.background(), ETCHED_DARK));
-                    p->drawArc(QRect(r.x(), r.y(), opts.crSize, opts.crSize), 225*16, 180*16);
-                    doneShadow=true;
-                }
-
-                p->setClipRegion(QRegion(clipRegion));
-                if(IS_FLAT(opts.appearance))
-                    p->fillRect(QRect(x+1, y+1, rect.width()-2, rect.height()-2), bgnd);
-                else
-                    drawBevelGradient(bgnd, bgnd, p, QRect(x+1, y+1, rect.width()-2, rect.height()-2), true,
-                                      drawSunken, app, wid);
-
-                if(coloredMo)
-                {
-                    p->setPen(use[CR_MO_FILL]);
-                    p->drawArc(QRect(x+1, y+1, opts.crSize-2, opts.crSize-2), 0, 360*16);
-//                     p->drawArc(QRect(x+2, y+2, opts.crSize-4, opts.crSize-4), 0, 360*16);
-//                     p->drawArc(QRect(x+3, y+3, opts.crSize-6, opts.crSize-6), 0, 360*16);
-                    p->drawPoint(x+2, y+4);
-                    p->drawPoint(x+4, y+2);
-                    p->drawPoint(x+8, y+2);
-                    p->drawPoint(x+10, y+4);
-                    p->drawPoint(x+2, y+8);
-                    p->drawPoint(x+4, y+10);
-                    p->drawPoint(x+8, y+10);
-                    p->drawPoint(x+10, y+8);
-                }
-
-                p->setClipping(false);
-
-                if(doEtch && !doneShadow)
-                {
-                    QColor topCol(glow
-                                    ? glowFocus ? itsFocusCols[GLOW_MO] : itsMouseOverCols[GLOW_MO]
-                                    : shade(cg.background(), ETCHED_DARK)),
-                           botCol(glow
-                                    ? topCol
-                                    : itsBackgroundCols[1]);
-
-                    p->setBrush(Qt::NoBrush);
-                    p->setPen(topCol);
-                    if(drawSunken || glow)
-                    {
-                        p->drawArc(QRect(r.x(), r.y(), opts.crSize, opts.crSize), 45*16, 180*16);
-                        p->setPen(botCol);
-                    }
-                    p->drawArc(QRect(r.x(), r.y(), opts.crSize, opts.crSize), 225*16, 180*16);
-                }
-
-                p->drawPixmap(rect.x(), rect.y(),
-                              *getPixmap(use[BORDER_VAL(flags&Style_Enabled)], PIX_RADIO_BORDER, 0.8));
-
-                if(QApplication::NormalColor!=QApplication::colorSpec() || itsFormMode)
-                {
-                    p->setPen(QPen(use[opts.coloredMouseOver && sflags&Style_MouseOver ? 4 : BORDER_VAL(flags&Style_Enabled)], 1));
-                    p->drawArc(rect, 0, 5760);
-                }
-
-                if(set)
-                    p->drawPixmap(rect.x(), rect.y(), *getPixmap(on, PIX_RADIO_ON, 1.0));
-                if(!coloredMo && (!opts.crButton || drawLight) && (QApplication::NormalColor==QApplication::colorSpec() || itsFormMode))
-                    p->drawPixmap(rect.x(), rect.y(),
-                                  *getPixmap(btn[drawLight ? LIGHT_BORDER(app)
-                                                           : (sflags&Style_MouseOver ? 3 : 4)],
-                                             lightBorder ? PIX_RADIO_INNER : PIX_RADIO_LIGHT));
-                p->restore();
-            }
+            else if(!drawCachedIndicator(pe, p, r, cg, flags))
+                drawRadioButton(p, r, cg, flags);
             break;
         case PE_DockWindowSeparator:
         {
@@ -3915,7 +4224,8 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
 //                 }
 //                 else
                 {
-                    itsFormMode=itsIsTransKicker;
+                    if(itsIsTransKicker)
+                        flags|=FORM_WIDGET;
                     if(sv && !opts.highlightScrollViews)
                         flags&=~Style_HasFocus;
                     if(sv && opts.etchEntry && ((QFrame *)widget)->lineWidth()>2)
@@ -3943,7 +4253,6 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                                    square ? ROUNDED_NONE : ROUNDED_ALL, use, sv ? WIDGET_SCROLLVIEW : WIDGET_OTHER, APP_KICKER!=itsThemedApp,
                                    itsIsTransKicker ? BORDER_FLAT : (flags&Style_Sunken ? BORDER_SUNKEN : BORDER_RAISED) );
                     }
-                    itsFormMode=false;
                 }
             }
             else
@@ -4019,28 +4328,18 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
         {
             // fix for toolbar lag (from Mosfet Liquid) 
             QWidget *w = dynamic_cast<QWidget *>(p->device());
+            bool    active(isActiveMenuBar(w));
 
-            if(w)
-            {
-                if(PaletteButton==w->backgroundMode())
-                    w->setBackgroundMode(PaletteBackground);
-
-                if(itsActive && opts.shadeMenubarOnlyWhenActive && SHADE_NONE!=opts.shadeMenubars)
-                {
-                    QWidget *top=w->topLevelWidget();
-
-                    if(top && !top->isActiveWindow())
-                        itsActive=false;
-                }
-            }
+            if(w && PaletteButton==w->backgroundMode())
+                w->setBackgroundMode(PaletteBackground);
 
             drawMenuOrToolBarBackground(p, r, cg, PE_PanelMenuBar==pe,
-                                        PE_PanelMenuBar==pe || r.width()>r.height());
+                                        PE_PanelMenuBar==pe || r.width()>r.height(), active);
 
             if(TB_NONE!=opts.toolbarBorders)
             {
                 const QColor *use=PE_PanelMenuBar==pe
-                                      ? menuColors(cg, itsActive)
+                                      ? menuColors(cg, active)
                                       : backgroundColors(cg.background());
                 bool         dark(TB_DARK==opts.toolbarBorders || TB_DARK_ALL==opts.toolbarBorders);
 
@@ -4217,7 +4516,7 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                     p->drawRect(r); // r2);
                 }
                 else
-                    drawBorder(cg.background(), p, r, cg, Style_Horizontal,
+                    drawBorder(cg.background(), p, r, cg, Style_Horizontal|(flags&FORM_WIDGET),
                                ROUNDED_ALL, itsFocusCols, WIDGET_FOCUS, false, BORDER_FLAT, true,
                                FOCUS_SHADE(flags&Style_Selected));
             }
@@ -4320,8 +4619,8 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
             // only thing we know is that khtml buffers its widgets into a pixmap. So
             // when the paint device is a QPixmap, chances are high that we are in khtml.
             // It's possible that this breaks other things, so let's see how it works...
-            if (p->device() && dynamic_cast<QPixmap*>(p->device()))
-                itsFormMode=true;
+            if(p->device() && dynamic_cast<QPixmap*>(p->device()))
+                flags|=FORM_WIDGET;
 
             if(scrollView && !opts.highlightScrollViews)
                 flags&=~Style_HasFocus;
@@ -4338,7 +4637,6 @@ void QtCurveStyle::drawPrimitive(PrimitiveElement pe, QPainter *p, const QRect &
                                                 : ENTRY_NONE,
                            (opts.square&SQUARE_SCROLLVIEW) && scrollView ? ROUNDED_NONE : ROUNDED_ALL,
                            scrollView ? WIDGET_SCROLLVIEW : WIDGET_ENTRY);
-            itsFormMode=false;
             break;
         }
         case PE_StatusBarSection:
@@ -4393,6 +4691,10 @@ void QtCurveStyle::drawKStylePrimitive(KStylePrimitive kpe, QPainter *p, const Q
                                        const QRect &r, const QColorGroup &cg, SFlags flags,
                                        const QStyleOption &opt) const
 {
+    QTC_PROFILE(CAT_KSTYLE_PRIMITIVE, kpe, widget, p);
+    QTC_RECORD(CAT_KSTYLE_PRIMITIVE, kpe, widget, p, r, cg, flags, 0, 0, opt);
+    PaintFlashGuard flash(itsPaintFlash, p, r, widget);
+
     ELine handles(kpe!=KPE_ToolBarHandle && LINE_DASHES==opts.handles ? LINE_SUNKEN
                                                                       : opts.handles);
 
@@ -4547,8 +4849,17 @@ void QtCurveStyle::drawControl(ControlElement control, QPainter *p, const QWidge
                                const QRect &r, const QColorGroup &cg, SFlags flags,
                                const QStyleOption &data) const
 {
+    QTC_PROFILE(CAT_CONTROL, control, widget, p);
+    QTC_RECORD(CAT_CONTROL, control, widget, p, r, cg, flags, 0, 0, data);
+    PaintFlashGuard flash(itsPaintFlash, p, r, widget);
+
+    if(itsRepaintMonitor && widget)
+        itsRepaintMonitor->painted(widget);
+
     if(widget==itsHoverWidget)
         flags|=Style_MouseOver;
+    if(isFormWidget(widget))
+        flags|=FORM_WIDGET;
 
     switch(control)
     {
@@ -5136,7 +5447,7 @@ void QtCurveStyle::drawControl(ControlElement control, QPainter *p, const QWidge
                 r2.setY(mb->rect().y()+1);
                 r2.setHeight(mb->rect().height()-2);
 
-                drawMenuOrToolBarBackground(p, r2, cg);
+                drawMenuOrToolBarBackground(p, r2, cg, true, true, isActiveMenuBar(widget));
             }
 
             if(active)
@@ -5169,7 +5480,7 @@ void QtCurveStyle::drawControl(ControlElement control, QPainter *p, const QWidge
             break;
         }
         case CE_MenuBarEmptyArea:
-            drawMenuOrToolBarBackground(p, r, cg);
+            drawMenuOrToolBarBackground(p, r, cg, true, true, isActiveMenuBar(widget));
             break;
         case CE_DockWindowEmptyArea:
             if(widget && widget->inherits("QToolBar"))
@@ -5365,8 +5676,6 @@ void QtCurveStyle::drawControl(ControlElement control, QPainter *p, const QWidge
             }
             else
             {
-                itsFormMode = isFormWidget(widget);
-
                 if(IND_FONT_COLOR==opts.defBtnIndicator && button->isDefault())
                     flags|=Style_ButtonDefault;
 
@@ -5379,14 +5688,11 @@ void QtCurveStyle::drawControl(ControlElement control, QPainter *p, const QWidge
                 drawPrimitive(PE_ButtonCommand, p, r, cg, flags);
                 if (button->isDefault() && IND_CORNER==opts.defBtnIndicator)
                     drawPrimitive(PE_ButtonDefault, p, r, cg, flags);
-                itsFormMode = false;
             }
             break;
         }
         case CE_CheckBox:
-            itsFormMode = isFormWidget(widget);
             drawPrimitive(PE_Indicator, p, r, cg, flags, data);
-            itsFormMode = false;
             break;
         case CE_CheckBoxLabel:
             if(opts.crHighlight || FOCUS_GLOW==opts.focus)
@@ -5428,9 +5734,7 @@ void QtCurveStyle::drawControl(ControlElement control, QPainter *p, const QWidge
                 BASE_STYLE::drawControl(control, p, widget, r, cg, flags, data);
             break;
         case CE_RadioButton:
-            itsFormMode=isFormWidget(widget);
             drawPrimitive(PE_ExclusiveIndicator, p, r, cg, flags, data);
-            itsFormMode=false;
             break;
         case CE_RadioButtonLabel:
             if(opts.crHighlight || FOCUS_GLOW==opts.focus)
@@ -5579,8 +5883,17 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                                       SCFlags controls, SCFlags active,
                                       const QStyleOption &data) const
 {
+    QTC_PROFILE(CAT_COMPLEX_CONTROL, control, widget, p);
+    QTC_RECORD(CAT_COMPLEX_CONTROL, control, widget, p, r, cg, flags, controls, active, data);
+    PaintFlashGuard flash(itsPaintFlash, p, r, widget);
+
+    if(itsRepaintMonitor && widget)
+        itsRepaintMonitor->painted(widget);
+
     if(widget==itsHoverWidget)
         flags |=Style_MouseOver;
+    if(isFormWidget(widget))
+        flags|=FORM_WIDGET;
 
     switch(control)
     {
@@ -5645,8 +5958,6 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
             if(active & SC_ToolButtonMenu)
                 mflags |=Style_Down;
 
-            itsFormMode = isFormWidget(widget);
-
             if(controls&SC_ToolButton)
             {
                 if(onControlButtons ||
@@ -5754,7 +6065,6 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                 drawPrimitive(PE_FocusRect, p, fr, cg);
             }
 
-            itsFormMode=false;
             break;
         }
         case CC_ComboBox:
@@ -5762,8 +6072,6 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
             if(APP_OPENOFFICE==itsThemedApp)
                 flags&=~Style_MouseOver;
 
-            itsFormMode = isFormWidget(widget);
-
             const QComboBox *combobox((const QComboBox *)widget);
             QRect           frame(QStyle::visualRect(querySubControlMetrics(CC_ComboBox, widget,
                                                                             SC_ComboBoxFrame,
@@ -5779,7 +6087,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                             sunken(combobox->listBox() ? combobox->listBox()->isShown() : false),
                             reverse(QApplication::reverseLayout());
             SFlags          fillFlags(flags),
-                            doEtch(!itsFormMode && DO_EFFECT && (!editable || opts.etchEntry));
+                            doEtch(!(flags&FORM_WIDGET) && DO_EFFECT && (!editable || opts.etchEntry));
 
             if(doEtch)
             {
@@ -5794,7 +6102,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                     fillFlags-=Style_MouseOver;
             }
 
-            if(editable ||(!itsFormMode && DO_EFFECT && qstrcmp(widget->name(), kdeToolbarWidget)))
+            if(editable ||(!(flags&FORM_WIDGET) && DO_EFFECT && qstrcmp(widget->name(), kdeToolbarWidget)))
             {
                 p->setPen(cg.background());
                 p->drawRect(r);
@@ -5812,7 +6120,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                 }
                 else
                 {
-                    const QColor *cols=itsComboBtnCols && editable  && flags&Style_Enabled ? itsComboBtnCols : use;
+                    const QColor *cols=comboBtnCols() && editable  && flags&Style_Enabled ? comboBtnCols() : use;
 
                     if(editable && HOVER_CB_ARROW!=itsHover)
                         fillFlags&=~Style_MouseOver;
@@ -5865,7 +6173,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                                             : ROUNDED_LEFT,
                                    WIDGET_COMBO);
                 }
-                else if(opts.comboSplitter && !(SHADE_DARKEN==opts.comboBtn || itsComboBtnCols))
+                else if(opts.comboSplitter && !(SHADE_DARKEN==opts.comboBtn || comboBtnCols()))
                 {
                     field.addCoords(1, sunken ? 2 : 1, sunken ? 2 : 1, -1);
                     p->setPen(use[BORDER_VAL(flags&Style_Enabled)]);
@@ -5892,7 +6200,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                             fr.addCoords(3, 0, 0, 0);
                         else
                             fr.addCoords(0, 0, -2, 0);
-                        if(!itsFormMode && DO_EFFECT)
+                        if(!(flags&FORM_WIDGET) && DO_EFFECT)
                                 fr.addCoords(1, 1, -1, -1);
                     }
                     else
@@ -5909,11 +6217,11 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
 
             if(controls&SC_ComboBoxArrow && arrow.isValid())
             {
-                if(!editable && (SHADE_DARKEN==opts.comboBtn || itsComboBtnCols))
+                if(!editable && (SHADE_DARKEN==opts.comboBtn || comboBtnCols()))
                 {
                     SFlags       btnFlags(flags);
                     QRect        btn(arrow.x(), frame.y(), arrow.width()+1, frame.height());
-                    const QColor *cols=SHADE_DARKEN==opts.comboBtn || !(flags&Style_Enabled) ? use : itsComboBtnCols;
+                    const QColor *cols=SHADE_DARKEN==opts.comboBtn || !(flags&Style_Enabled) ? use : comboBtnCols();
                     if(!sunken)
                         btnFlags|=Style_Raised;
                     p->save();
@@ -5951,13 +6259,10 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
             }
 
             p->setPen(cg.buttonText());
-            itsFormMode = false;
             break;
         }
         case CC_SpinWidget:
         {
-            itsFormMode = isFormWidget(widget);
-
             const QSpinWidget *spinwidget((const QSpinWidget *)widget);
             QRect             frame(querySubControlMetrics(CC_SpinWidget, widget, SC_SpinWidgetFrame,
                                     data)),
@@ -5967,7 +6272,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
             bool              hw(itsHoverWidget && itsHoverWidget==spinwidget),
                               reverse(QApplication::reverseLayout()),
                               doFrame((controls&SC_SpinWidgetFrame) && frame.isValid()),
-                              doEtch(!itsFormMode && DO_EFFECT && opts.etchEntry);
+                              doEtch(!(flags&FORM_WIDGET) && DO_EFFECT && opts.etchEntry);
 
             if(doEtch)
             {
@@ -6082,7 +6387,6 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                 if(doEtch)
                     drawEtch(p, spinwidget ? spinwidget->rect() : r, cg, false, (opts.square&SQUARE_ENTRY));
             }
-            itsFormMode=false;
             break;
         }
         case CC_ScrollBar:
@@ -6094,7 +6398,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                              maxed(sb->minValue() == sb->maxValue()),
                              atMin(maxed || sb->value()==sb->minValue()),
                              atMax(maxed || sb->value()==sb->maxValue());
-            SFlags           sflags((horiz ? Style_Horizontal : Style_Default) |
+            SFlags           sflags((horiz ? Style_Horizontal : Style_Default) | (flags&FORM_WIDGET) |
                                     (maxed || !widget->isEnabled() ? Style_Default : Style_Enabled));
             QRect            subline(querySubControlMetrics(control, widget, SC_ScrollBarSubLine,
                                                             data)),
@@ -6113,9 +6417,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                              subline2(addline),
                              sbRect(sb->rect());
 
-            itsFormMode=isFormWidget(widget);
-
-            if(itsFormMode)
+            if(flags&FORM_WIDGET)
             {
                 // See KHTML note at top of file
                 if(horiz)
@@ -6268,7 +6570,7 @@ void QtCurveStyle::drawComplexControl(ComplexControl control, QPainter *p, const
                 bool enable=!atMax;
 
                 // See KHTML note at top of file
-                if(itsFormMode && SCROLLBAR_NEXT!=opts.scrollbarType)
+                if((flags&FORM_WIDGET) && SCROLLBAR_NEXT!=opts.scrollbarType)
                     if(horiz)
                         addline.addCoords(0, 0, -1, 0);
                     else
@@ -7280,10 +7582,9 @@ void QtCurveStyle::drawMenuItem(QPainter *p, const QRect &r, int flags, const QC
     }
     else if(mbi || opts.borderMenuitems)
     {
-        int  flags(Style_Raised);
+        int  flags(Style_Raised|FORM_WIDGET);
         bool stdColor(!mbi || (SHADE_BLEND_SELECTED!=opts.shadeMenubars && SHADE_SELECTED!=opts.shadeMenubars));
 
-        itsFormMode=true;
         flags|=Style_Horizontal;
 
         if(stdColor && opts.borderMenuitems)
@@ -7299,7 +7600,6 @@ void QtCurveStyle::drawMenuItem(QPainter *p, const QRect &r, int flags, const QC
                 drawBevelGradient(cols[fill], cg.background(), p, fr, true, false, opts.menuitemAppearance, WIDGET_MENU_ITEM);
             drawBorder(bgnd, p, r, cg, flags, round, cols, WIDGET_OTHER, false, BORDER_FLAT, false, border);
         }
-        itsFormMode=false;
     }
     else
         drawBevelGradient(cols[fill], cg.background(), p, r, true, false, opts.menuitemAppearance, WIDGET_MENU_ITEM);
@@ -7369,8 +7669,8 @@ void QtCurveStyle::drawProgress(QPainter *p, const QRect &rx, const QColorGroup
     }
 
     const QColor *use=flags&Style_Enabled || ECOLOR_BACKGROUND==opts.progressGrooveColor
-                        ? itsProgressCols
-                            ? itsProgressCols
+                        ? progressCols()
+                            ? progressCols()
                             : itsHighlightCols
                         : itsBackgroundCols;
 
@@ -7399,8 +7699,43 @@ void QtCurveStyle::drawProgress(QPainter *p, const QRect &rx, const QColorGroup
     }
 }
 
+// Background colour is only used for stops that are not fully opaque...
+static bool hasAlphaStops(const Gradient *grad)
+{
+    GradientStopCont::const_iterator it(grad->stops.begin()),
+                                     end(grad->stops.end());
+
+    for(; it!=end; ++it)
+        if((*it).alpha<0.9999)
+            return true;
+    return false;
+}
+
+static int tileCost(const QPixmap &pix)
+{
+    return pix.width()*pix.height()*((pix.depth()/8)+(pix.hasAlphaChannel() ? 1 : 0));
+}
+
+// Only key on those parameters that actually affect the gradient - so that, for example,
+// buttons on different coloured backgrounds share the same gradient...
+QString QtCurveStyle::gradientKey(const QColor &base, const QColor &bgnd, int size, int len, bool horiz, bool sel,
+                                  EAppearance app, EWidget w, bool &useBgnd, bool &argb) const
+{
+    bool tab(WIDGET_TAB_TOP==w || WIDGET_TAB_BOT==w),
+         selTab(tab && opts.colorSelTab && (sel || WIDGET_TAB_BOT==w));
+
+    useBgnd=hasAlphaStops(qtcGetGradient(app, &opts));
+    argb=useBgnd && useXRender();
+
+    return createKey(size, len, base.rgb(), useBgnd && !argb ? bgnd.rgb() : 0, horiz, app,
+                     WIDGET_TAB_TOP==w ? 1 : WIDGET_TAB_BOT==w ? 2 : 0, tab && sel,
+                     selTab ? itsHighlightCols[0].rgb() : 0, argb);
+}
+
 void QtCurveStyle::drawBevelGradient(const QColor &base, const QColor &bgnd, QPainter *p, const QRect &origRect, bool horiz, bool sel, EAppearance bevApp, EWidget w) const
 {
+    QTC_PROFILE(CAT_BEVEL_GRADIENT, w, 0L, p);
+
     if(IS_FLAT(bevApp) && opts.colorSelTab && sel)
         bevApp=APPEARANCE_GRADIENT;
 
@@ -7418,22 +7753,71 @@ void QtCurveStyle::drawBevelGradient(const QColor &base, const QColor &bgnd, QPa
                                   WIDGET_NO_ETCH_BTN==w || WIDGET_MENU_BUTTON==w
                                     ? bevApp
                                     : APPEARANCE_GRADIENT);
-        QRect       r(0, 0, horiz ? PIXMAP_DIMENSION : origRect.width(),
-                      horiz ? origRect.height() : PIXMAP_DIMENSION);
-        QString     key(createKey(horiz ? r.height() : r.width(), base.rgb(), bgnd.rgb(), horiz, app,
-                                  tab && sel && opts.colorSelTab ? CACHE_COL_SEL_TAB : CACHE_STD));
+        int         size(horiz ? origRect.height() : origRect.width()),
+                    len(gradientTileLength(horiz ? origRect.width() : origRect.height(), size));
+        QRect       r(0, 0, horiz ? len : size, horiz ? size : len);
+        bool        useBgnd,
+                    argb;
+        QString     key(gradientKey(base, bgnd, size, len, horiz, sel, app, w, useBgnd, argb));
         QPixmap     *pix(itsPixmapCache.find(key));
         bool        inCache(true);
 
+        QTC_COUNT("gradient lookups", 1);
+#ifdef QTC_ENABLE_PROFILER
+        // Measure the de-duplication due to the normalised keys - i.e. the hits on tiles that would have
+        // been drawn again, had the key always included the background colour and selected state...
+        if(QtCProfiler::instance())
+        {
+            static QMap<QString, bool> fullKeys,
+                                       keys;
+            QString                    fullKey;
+
+            QTextOStream(&fullKey) << key << '-' << bgnd.rgb() << '-' << sel;
+            if(!fullKeys.contains(fullKey))
+            {
+                fullKeys.insert(fullKey, true);
+                QTC_COUNT("gradient keys, without normalisation", 1);
+                if(pix)
+                    QTC_COUNT("gradient tiles saved by normalised keys", 1);
+            }
+            if(!keys.contains(key))
+            {
+                keys.insert(key, true);
+                QTC_COUNT("gradient keys", 1);
+            }
+        }
+#endif
+
         if(!pix)
         {
+            QTC_COUNT("gradient misses", 1);
             pix=new QPixmap(r.width(), r.height());
 
-            QPainter pixPainter(pix);
+            // If the image can be passed via shared memory, then it is cheaper to draw the gradient
+            // client side than to send a line request per row. ARGB gradients are always drawn
+            // client side, as QPainter cannot draw alpha into a pixmap - as are those that may be
+            // shared with other processes, as these are found via a hash of their contents, and
+            // those that are being recorded into an atlas...
+            if(!findTile(*pix, key))
+            {
+                if(argb || itsSharedPixmaps || itsUploader->accelerated(r.width()*r.height()*4) ||
+                   !itsAtlasFile.isEmpty())
+                {
+                    QImage img(r.width(), r.height(), 32);
 
-            drawBevelGradientReal(base, bgnd, &pixPainter, r, horiz, sel, app, w);
-            pixPainter.end();
-            int cost(pix->width()*pix->height()*(pix->depth()/8));
+                    img.setAlphaBuffer(argb);
+                    drawBevelGradientReal(base, bgnd, 0L, r, horiz, sel, app, w, &img);
+                    uploadTile(*pix, key, img);
+                }
+                else
+                {
+                    QPainter pixPainter(pix);
+
+                    drawBevelGradientReal(base, bgnd, &pixPainter, r, horiz, sel, app, w);
+                    pixPainter.end();
+                }
+            }
+            int cost(tileCost(*pix));
 
             if(cost<itsPixmapCache.maxCost())
                 itsPixmapCache.insert(key, pix, cost);
@@ -7441,13 +7825,67 @@ void QtCurveStyle::drawBevelGradient(const QColor &base, const QColor &bgnd, QPa
                 inCache=false;
         }
 
+        // Semi-transparent stops are composited (via XRender) onto the background colour...
+        if(argb)
+            p->fillRect(origRect, bgnd);
         p->drawTiledPixmap(origRect, *pix);
         if(!inCache)
             delete pix;
     }
 }
 
-void QtCurveStyle::drawBevelGradientReal(const QColor &base, const QColor &bgnd, QPainter *p, const QRect &r, bool horiz, bool sel, EAppearance app, EWidget w) const
+// Fill r within a 32-bit image - as per drawGradient, but also blending the alpha (which is only
+// used for ARGB images)...
+static void fillGradient(const QColor &top, const QColor &bot, QImage &img, const QRect &r, bool horiz,
+                         double topAlpha, double botAlpha)
+{
+    QRect rect(r.intersect(img.rect()));
+
+    if(rect.isEmpty())
+        return;
+
+    int size(horiz ? r.height() : r.width()),
+        rTop(top.red()), gTop(top.green()), bTop(top.blue()), aTop((int)(topAlpha*255.0+0.5)),
+        rl(rTop << 16), gl(gTop << 16), bl(bTop << 16), al(aTop << 16),
+        dr(((1<<16) * (bot.red() - rTop)) / size),
+        dg(((1<<16) * (bot.green() - gTop)) / size),
+        db(((1<<16) * (bot.blue() - bTop)) / size),
+        da(((1<<16) * ((int)(botAlpha*255.0+0.5) - aTop)) / size),
+        i, x, y;
+
+    for(i=0; i<size; i++)
+    {
+        QRgb rgb(qRgba(rl>>16, gl>>16, bl>>16, al>>16));
+
+        if(horiz)
+        {
+            y=r.y()+i;
+            if(y>=rect.y() && y<=rect.bottom())
+            {
+                QRgb *line=(QRgb *)img.scanLine(y);
+
+                for(x=rect.x(); x<=rect.right(); ++x)
+                    line[x]=rgb;
+            }
+        }
+        else
+        {
+            x=r.x()+i;
+            if(x>=rect.x() && x<=rect.right())
+                for(y=rect.y(); y<=rect.bottom(); ++y)
+                    ((QRgb *)img.scanLine(y))[x]=rgb;
+        }
+        rl += dr;
+        gl += dg;
+        bl += db;
+        al += da;
+    }
+}
+
+// Only reads the options and colour sets - so, when drawing into an image, this has no side effects
+// upon the style...
+void QtCurveStyle::drawBevelGradientReal(const QColor &base, const QColor &bgnd, QPainter *p, const QRect &r, bool horiz, bool sel, EAppearance app, EWidget w,
+                                         QImage *img) const
 {
 
     const Gradient *grad=qtcGetGradient(app, &opts);
@@ -7455,8 +7893,10 @@ void QtCurveStyle::drawBevelGradientReal(const QColor &base, const QColor &bgnd,
                    lastPos(0),
                    size(horiz ? r.height() : r.width());
     bool           topTab(WIDGET_TAB_TOP==w),
-                   botTab(WIDGET_TAB_BOT==w);
+                   botTab(WIDGET_TAB_BOT==w),
+                   argb(img && img->hasAlphaBuffer());
     QColor         prev;
+    double         prevAlpha(1.0);
 
     if(botTab)
     {
@@ -7475,15 +7915,21 @@ void QtCurveStyle::drawBevelGradientReal(const QColor &base, const QColor &bgnd,
 
             if(/*sel && */opts.colorSelTab && i>0)
                 col=tint(col, itsHighlightCols[0], (1.0-(*it).pos)*(0.2+TO_ALPHA(opts.colorSelTab)));
-            if((*it).alpha<0.9999)
+            if((*it).alpha<0.9999 && !argb)
                 col=tint(bgnd, col, (*it).alpha);
             if(i)
-                drawGradient(prev, col, p,
-                             horiz
-                                ? QRect(r.x(), lastPos, r.width(), pos-lastPos)
-                                : QRect(lastPos, r.y(), pos-lastPos, r.height()),
-                             horiz);
+            {
+                QRect seg(horiz
+                            ? QRect(r.x(), lastPos, r.width(), pos-lastPos)
+                            : QRect(lastPos, r.y(), pos-lastPos, r.height()));
+
+                if(img)
+                    fillGradient(prev, col, *img, seg, horiz, argb ? prevAlpha : 1.0, argb ? (*it).alpha : 1.0);
+                else
+                    drawGradient(prev, col, p, seg, horiz);
+            }
             prev=col;
+            prevAlpha=(*it).alpha;
             lastPos=pos;
         }
     }
@@ -7504,15 +7950,21 @@ void QtCurveStyle::drawBevelGradientReal(const QColor &base, const QColor &bgnd,
 
             if(sel && opts.colorSelTab && topTab && i<numStops-1)
                 col=tint(col, itsHighlightCols[0], (1.0-(*it).pos)*(0.2+TO_ALPHA(opts.colorSelTab)));
-            if((*it).alpha<0.9999)
+            if((*it).alpha<0.9999 && !argb)
                 col=tint(bgnd, col, (*it).alpha);
             if(i)
-                drawGradient(prev, col, p,
-                             horiz
-                                ? QRect(r.x(), lastPos, r.width(), pos-lastPos)
-                                : QRect(lastPos, r.y(), pos-lastPos, r.height()),
-                             horiz);
+            {
+                QRect seg(horiz
+                            ? QRect(r.x(), lastPos, r.width(), pos-lastPos)
+                            : QRect(lastPos, r.y(), pos-lastPos, r.height()));
+
+                if(img)
+                    fillGradient(prev, col, *img, seg, horiz, argb ? prevAlpha : 1.0, argb ? (*it).alpha : 1.0);
+                else
+                    drawGradient(prev, col, p, seg, horiz);
+            }
             prev=col;
+            prevAlpha=(*it).alpha;
             lastPos=pos;
         }
     }
@@ -7524,6 +7976,14 @@ void QtCurveStyle::drawGradient(const QColor &top, const QColor &bot, QPainter *
     {
         if(top==bot)
             p->fillRect(r, top);
+        else if(itsLowBandwidth && (!p->device() || QInternal::Pixmap!=p->device()->devType()))
+        {
+            // Drawing directly onto a widget would require 1 request per line - and this would need
+            // to be re-sent upon every repaint. (Gradients drawn into cached pixmaps are only sent
+            // once, so these are left as is.)
+            p->fillRect(r, midColor(top, bot));
+            QTC_COUNT("low bandwidth: X requests saved", (horiz ? r.height() : r.width())-1);
+        }
         else
         {
             int rh(r.height()), rw(r.width()),
@@ -7784,11 +8244,9 @@ void QtCurveStyle::drawSliderHandle(QPainter *p, const QRect &r, const QColorGro
         }
         else
         {
-            p->drawPixmap(x, y,
-                        *getPixmap(border[borderVal],
-                                    horiz ? PIX_SLIDER : PIX_SLIDER_V, 0.8));
+            drawImage(p, x, y, border[borderVal], horiz ? PIX_SLIDER : PIX_SLIDER_V, 0.8);
             if(drawLight)
-                p->drawPixmap(x, y, *getPixmap(use[0], horiz ? PIX_SLIDER_LIGHT : PIX_SLIDER_LIGHT_V));
+                drawImage(p, x, y, use[0], horiz ? PIX_SLIDER_LIGHT : PIX_SLIDER_LIGHT_V);
         }
         p->restore();
     }
@@ -7821,7 +8279,7 @@ void QtCurveStyle::drawSliderGroove(QPainter *p, const QRect &r, const QColorGro
         groove.addCoords(0, dh, 0, -dh);
         flags|=Style_Horizontal;
 
-        if(!itsFormMode && DO_EFFECT)
+        if(!(flags&FORM_WIDGET) && DO_EFFECT)
             groove.addCoords(0, -1, 0, 1);
     }
     else
@@ -7829,7 +8287,7 @@ void QtCurveStyle::drawSliderGroove(QPainter *p, const QRect &r, const QColorGro
         int dw=(groove.width()-5)>>1;
         groove.addCoords(dw, 0, -dw, 0);
 
-        if(!itsFormMode && DO_EFFECT)
+        if(!(flags&FORM_WIDGET) && DO_EFFECT)
             groove.addCoords(-1, 0, 1, 0);
     }
 
@@ -7846,7 +8304,7 @@ void QtCurveStyle::drawSliderGroove(QPainter *p, const QRect &r, const QColorGro
                                      (sliderWidget->value() - sliderWidget->minValue())));
         if(pos>0)
         {
-            const QColor *usedCols=itsSliderCols ? itsSliderCols : itsHighlightCols;
+            const QColor *usedCols=sliderCols() ? sliderCols() : itsHighlightCols;
 
             if(horiz)
             {
@@ -7869,7 +8327,7 @@ void QtCurveStyle::drawSliderGroove(QPainter *p, const QRect &r, const QColorGro
 }
 
 void QtCurveStyle::drawMenuOrToolBarBackground(QPainter *p, const QRect &r, const QColorGroup &cg,
-                                               bool menu, bool horiz) const
+                                               bool menu, bool horiz, bool active) const
 {
     if(menu && (APPEARANCE_STRIPED==opts.bgndAppearance || APPEARANCE_FILE==opts.bgndAppearance) &&
        IS_FLAT(opts.menubarAppearance) && SHADE_NONE==opts.shadeMenubars)
@@ -7877,7 +8335,7 @@ void QtCurveStyle::drawMenuOrToolBarBackground(QPainter *p, const QRect &r, cons
 
     QRect       rx(r);
     EAppearance app(menu ? opts.menubarAppearance : opts.toolbarAppearance);
-    QColor      color(menu ? menuColors(cg, itsActive)[ORIGINAL_SHADE] : cg.background());
+    QColor      color(menu ? menuColors(cg, active)[ORIGINAL_SHADE] : cg.background());
 
     if(menu && BLEND_TITLEBAR)
         rx.addCoords(0, -qtcGetWindowBorderSize().titleHeight, 0, 0);
@@ -7965,6 +8423,226 @@ void QtCurveStyle::shadeColors(const QColor &base, QColor *vals) const
     vals[ORIGINAL_SHADE]=base;
 }
 
+const QColor * QtCurveStyle::derivedColors(EShadeSet set) const
+{
+    if(!(itsResolvedShades&(1<<set)))
+    {
+        const QColor *cols(0L);
+        QColor       base;
+        bool         derive(false);
+
+        switch(set)
+        {
+            case SHADES_SLIDER:
+                switch(opts.shadeSliders)
+                {
+                    default:
+                        break;
+                    case SHADE_SELECTED:
+                        cols=itsHighlightCols;
+                        break;
+                    case SHADE_BLEND_SELECTED:
+                        base=midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), derive=true;
+                        break;
+                    case SHADE_CUSTOM:
+                        base=opts.customSlidersColor, derive=true;
+                }
+                break;
+            case SHADES_DEF_BTN:
+                switch(opts.defBtnIndicator)
+                {
+                    default:
+                        break;
+                    case IND_GLOW:
+                    case IND_SELECTED:
+                        cols=itsHighlightCols;
+                        break;
+                    case IND_TINT:
+                        base=tint(itsButtonCols[ORIGINAL_SHADE], itsHighlightCols[ORIGINAL_SHADE], DEF_BNT_TINT), derive=true;
+                        break;
+                    case IND_COLORED:
+                        base=midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), derive=true;
+                }
+                break;
+            case SHADES_COMBO_BTN:
+                switch(opts.comboBtn)
+                {
+                    default:
+                        break;
+                    case SHADE_SELECTED:
+                        cols=itsHighlightCols;
+                        break;
+                    case SHADE_BLEND_SELECTED:
+                        base=midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), derive=true;
+                        break;
+                    case SHADE_CUSTOM:
+                        base=opts.customComboBtnColor, derive=true;
+                }
+                break;
+            case SHADES_SORTED_LV:
+            {
+                const QColor &lv(opts.lvButton ? itsButtonCols[ORIGINAL_SHADE] : itsBackgroundCols[ORIGINAL_SHADE]);
+
+                switch(opts.sortedLv)
+                {
+                    default:
+                        break;
+                    case SHADE_DARKEN:
+                        base=shade(lv, LV_HEADER_DARK_FACTOR), derive=true;
+                        break;
+                    case SHADE_SELECTED:
+                        cols=itsHighlightCols;
+                        break;
+                    case SHADE_BLEND_SELECTED:
+                        base=midColor(itsHighlightCols[ORIGINAL_SHADE], lv), derive=true;
+                        break;
+                    case SHADE_CUSTOM:
+                        base=opts.customSortedLvColor, derive=true;
+                }
+                break;
+            }
+            case SHADES_CHECK_RADIO_SEL:
+                switch(opts.crColor)
+                {
+                    default:
+                        cols=itsButtonCols;
+                        break;
+                    case SHADE_DARKEN:
+                        base=shade(itsButtonCols[ORIGINAL_SHADE], LV_HEADER_DARK_FACTOR), derive=true;
+                        break;
+                    case SHADE_SELECTED:
+                        cols=itsHighlightCols;
+                        break;
+                    case SHADE_BLEND_SELECTED:
+                        base=midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), derive=true;
+                        break;
+                    case SHADE_CUSTOM:
+                        base=opts.customCrBgndColor, derive=true;
+                }
+                break;
+            case SHADES_PROGRESS:
+                switch(opts.progressColor)
+                {
+                    default:
+                        // Not set - use highlight
+                        break;
+                    case SHADE_NONE:
+                        cols=itsBackgroundCols;
+                        break;
+                    case SHADE_BLEND_SELECTED:
+                        base=midColor(itsHighlightCols[ORIGINAL_SHADE], itsBackgroundCols[ORIGINAL_SHADE]), derive=true;
+                        break;
+                    case SHADE_CUSTOM:
+                        base=opts.customProgressColor, derive=true;
+                }
+                break;
+            case SHADES_SIDEBAR_BUTTONS:
+                base=midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]), derive=true;
+                break;
+            case SHADES_POPUP_MENU:
+            {
+                const QColor *menu(opts.shadePopupMenu
+                                    ? SHADE_WINDOW_BORDER==opts.shadeMenubars
+                                        ? getMdiColors(QApplication::palette().active(), true)
+                                        : itsMenubarCols
+                                    : itsBackgroundCols);
+
+                if(USE_LIGHTER_POPUP_MENU)
+                    base=shade(menu[ORIGINAL_SHADE], TO_FACTOR(opts.lighterPopupMenuBgnd)), derive=true;
+                else
+                    cols=menu;
+                break;
+            }
+            default:
+                break;
+        }
+
+        if(derive)
+        {
+            // No need to intern a set that is identical to one of the standard sets...
+            if(base==itsHighlightCols[ORIGINAL_SHADE])
+                cols=itsHighlightCols;
+            else if(base==itsButtonCols[ORIGINAL_SHADE])
+                cols=itsButtonCols;
+            else if(base==itsBackgroundCols[ORIGINAL_SHADE])
+                cols=itsBackgroundCols;
+            else
+            {
+                itsShadeSets[set]=internShades(base);
+                cols=itsShadeSets[set]->cols;
+            }
+        }
+
+        itsDerivedCols[set]=cols;
+        itsResolvedShades|=1<<set;
+    }
+
+    return itsDerivedCols[set];
+}
+
+QtCShades * QtCurveStyle::internShades(const QColor &base) const
+{
+    QString                              key(createKey(base.rgb(), opts.contrast, opts.highlightFactor,
+                                                       USE_CUSTOM_SHADES(opts)));
+    QMap<QString, QtCShades *>::Iterator it(itsShadeStore.find(key));
+    QtCShades                            *shades(0L);
+
+    if(it==itsShadeStore.end())
+    {
+        // The store itself holds the initial reference...
+        shades=new QtCShades;
+        shadeColors(base, shades->cols);
+        itsShadeStore.insert(key, shades);
+    }
+    else
+        shades=it.data();
+
+    shades->ref();
+    return shades;
+}
+
+void QtCurveStyle::releaseShades(QtCShades *&shades) const
+{
+    // Sets are only ever deleted by the store...
+    if(shades)
+        shades->deref();
+    shades=0L;
+}
+
+void QtCurveStyle::releaseShades()
+{
+    for(int i=0; i<NUM_SHADE_SETS; ++i)
+        releaseShades(itsShadeSets[i]);
+    itsResolvedShades=0;
+}
+
+void QtCurveStyle::pruneShades()
+{
+    // Keep a few unused sets, so that switching back and forth between palettes does not
+    // need to re-shade. Anything more than this is removed.
+    QMap<QString, QtCShades *>::Iterator it(itsShadeStore.begin()),
+                                         end(itsShadeStore.end());
+    int                                  unused(0);
+
+    for(; it!=end; ++it)
+        if(1==it.data()->count)
+            unused++;
+
+    for(it=itsShadeStore.begin(); unused>MAX_UNUSED_SHADES && it!=end; )
+        if(1==it.data()->count)
+        {
+            QMap<QString, QtCShades *>::Iterator next(it);
+
+            ++next;
+            delete it.data();
+            itsShadeStore.remove(it);
+            it=next;
+            unused--;
+        }
+        else
+            ++it;
+}
+
 const QColor * QtCurveStyle::buttonColors(const QColorGroup &cg) const
 {
     if(cg.button()!=itsButtonCols[ORIGINAL_SHADE])
@@ -7978,21 +8656,21 @@ const QColor * QtCurveStyle::buttonColors(const QColorGroup &cg) const
 
 const QColor * QtCurveStyle::popupMenuCols(const QColorGroup &cg) const
 {
-    return USE_LIGHTER_POPUP_MENU || opts.shadePopupMenu ? itsPopupMenuCols : backgroundColors(cg);
+    return USE_LIGHTER_POPUP_MENU || opts.shadePopupMenu ? derivedColors(SHADES_POPUP_MENU) : backgroundColors(cg);
 }
 
 const QColor * QtCurveStyle::checkRadioColors(const QColorGroup &cg, SFlags flags) const
 {
     return opts.crColor && flags&Style_Enabled && (flags&Style_On || !(flags&Style_Off))
-        ? itsCheckRadioSelCols
+        ? checkRadioSelCols()
         : buttonColors(cg);
 }
 
 const QColor * QtCurveStyle::sliderColors(/*const QColorGroup &cg, */ SFlags flags) const
 {
     return (flags&Style_Enabled)
-                ? SHADE_NONE!=opts.shadeSliders &&itsSliderCols && (!opts.colorSliderMouseOver || flags&Style_MouseOver)
-                        ? itsSliderCols
+                ? SHADE_NONE!=opts.shadeSliders &&sliderCols() && (!opts.colorSliderMouseOver || flags&Style_MouseOver)
+                        ? sliderCols()
                         : itsButtonCols // buttonColors(cg)
                 : itsBackgroundCols;
 }
@@ -8016,21 +8694,7 @@ const QColor * QtCurveStyle::borderColors(SFlags flags, const QColor *use) const
 
 const QColor * QtCurveStyle::getSidebarButtons() const
 {
-    if(!itsSidebarButtonsCols)
-    {
-        if(SHADE_BLEND_SELECTED==opts.shadeSliders)
-            itsSidebarButtonsCols=itsSliderCols;
-        else if(IND_COLORED==opts.defBtnIndicator)
-            itsSidebarButtonsCols=itsDefBtnCols;
-        else
-        {
-            itsSidebarButtonsCols=new QColor [TOTAL_SHADES+1];
-            shadeColors(midColor(itsHighlightCols[ORIGINAL_SHADE], itsButtonCols[ORIGINAL_SHADE]),
-                        itsSidebarButtonsCols);
-        }
-    }
-
-    return itsSidebarButtonsCols;
+    return derivedColors(SHADES_SIDEBAR_BUTTONS);
 }
 
 void QtCurveStyle::setMenuColors(const QColorGroup &cg)
@@ -8058,21 +8722,6 @@ void QtCurveStyle::setMenuColors(const QColorGroup &cg)
         case SHADE_WINDOW_BORDER:
             break;
     }
-
-    QColor *base=opts.shadePopupMenu
-                    ? SHADE_WINDOW_BORDER==opts.shadeMenubars
-                        ? (QColor *)getMdiColors(cg, true)
-                        : itsMenubarCols
-                    : itsBackgroundCols;
-
-    if(USE_LIGHTER_POPUP_MENU)
-    {
-        if(!itsPopupMenuCols)
-            itsPopupMenuCols=new QColor [TOTAL_SHADES+1];
-        shadeColors(shade(base[ORIGINAL_SHADE], TO_FACTOR(opts.lighterPopupMenuBgnd)), itsPopupMenuCols);
-    }
-    else
-        itsPopupMenuCols=base;
 }
 
 void QtCurveStyle::setMenuTextColors(QWidget *widget, bool isMenuBar) const
@@ -8144,17 +8793,50 @@ void QtCurveStyle::setDecorationColors(bool init)
 
     if(opts.coloredMouseOver)
     {
-        if(!itsMouseOverCols)
-            itsMouseOverCols=new QColor [TOTAL_SHADES+1];
-        shadeColors(kdeSettings.hover, itsMouseOverCols);
+        QtCShades *old(itsMouseOverShades);
+
+        // Intern the new set before releasing the old, so that an unchanged colour is not re-shaded...
+        itsMouseOverShades=internShades(kdeSettings.hover);
+        itsMouseOverCols=itsMouseOverShades->cols;
+        releaseShades(old);
     }
+
     shadeColors(kdeSettings.focus, itsFocusCols);
+
+    // Cached bevels and indicators are keyed on these...
+    updatePaletteKey();
+}
+
+// The colours that cached bevels and indicators may use, other than those passed in to draw them. These
+// form part of their keys, so that a key always refers to the same pixels - in any process, and hence
+// in an atlas...
+void QtCurveStyle::updatePaletteKey()
+{
+    itsPaletteKey=QString::null;
+    QTextOStream(&itsPaletteKey) << itsHighlightCols[ORIGINAL_SHADE].rgb() << '-'
+                                 << itsBackgroundCols[ORIGINAL_SHADE].rgb() << '-'
+                                 << itsButtonCols[ORIGINAL_SHADE].rgb() << '-'
+                                 << (itsMouseOverCols ? itsMouseOverCols[ORIGINAL_SHADE].rgb() : 0) << '-'
+                                 << itsFocusCols[ORIGINAL_SHADE].rgb();
+}
+
+// Whether a menubar is drawn with its active colours. This is decided from the window being painted,
+// so that one window's activation does not affect the menubars of others...
+bool QtCurveStyle::isActiveMenuBar(const QWidget *widget) const
+{
+    if(!widget || !opts.shadeMenubarOnlyWhenActive || SHADE_NONE==opts.shadeMenubars)
+        return true;
+
+    const QWidget *top=widget->topLevelWidget();
+
+    return !top || top->isActiveWindow();
 }
 
 const QColor * QtCurveStyle::getMdiColors(const QColorGroup &cg, bool active) const
 {
-    if(!itsActiveMdiColors)
+    if(!itsReadMdiColors)
     {
+        itsReadMdiColors=true;
         itsActiveMdiTextColor=cg.text();
         itsMdiTextColor=cg.text();
 
@@ -8182,8 +8864,7 @@ const QColor * QtCurveStyle::getMdiColors(const QColorGroup &cg, bool active) co
 
                             if(col!=itsBackgroundCols[ORIGINAL_SHADE])
                             {
-                                itsActiveMdiColors=new QColor [TOTAL_SHADES+1]; 
-                                shadeColors(col, itsActiveMdiColors);
+                                itsActiveMdiColors=internShades(col);
                             }
                         }
                         else if(!itsMdiColors && 0==line.find("inactiveBackground=#", false))
@@ -8193,8 +8874,7 @@ const QColor * QtCurveStyle::getMdiColors(const QColorGroup &cg, bool active) co
                             setRgb(&col, line.mid(19).latin1());
                             if(col!=itsBackgroundCols[ORIGINAL_SHADE])
                             {
-                                itsMdiColors=new QColor [TOTAL_SHADES+1];
-                                shadeColors(col, itsMdiColors);
+                                itsMdiColors=internShades(col);
                             }
                         }
                         else if(0==line.find("activeForeground=#", false))
@@ -8233,8 +8913,7 @@ const QColor * QtCurveStyle::getMdiColors(const QColorGroup &cg, bool active) co
 
                             if(col!=itsBackgroundCols[ORIGINAL_SHADE])
                             {
-                                itsActiveMdiColors=new QColor [TOTAL_SHADES+1];
-                                shadeColors(col, itsActiveMdiColors);
+                                itsActiveMdiColors=internShades(col);
                             }
                         }
                         else if(!itsMdiColors && 0==line.find("inactiveBackground=", false))
@@ -8244,8 +8923,7 @@ const QColor * QtCurveStyle::getMdiColors(const QColorGroup &cg, bool active) co
                             setRgb(&col, QStringList::split(",", line.mid(19)));
                             if(col!=itsBackgroundCols[ORIGINAL_SHADE])
                             {
-                                itsMdiColors=new QColor [TOTAL_SHADES+1];
-                                shadeColors(col, itsMdiColors);
+                                itsMdiColors=internShades(col);
                             }
                         }
                         else if(0==line.find("activeForeground=", false))
@@ -8261,18 +8939,11 @@ const QColor * QtCurveStyle::getMdiColors(const QColorGroup &cg, bool active) co
                 f.close();
             }
         }
-
-        if(opts.shadeMenubarOnlyWhenActive && SHADE_WINDOW_BORDER==opts.shadeMenubars &&
-           itsActiveMdiColors && itsMdiColors && itsActiveMdiColors[ORIGINAL_SHADE]==itsMdiColors[ORIGINAL_SHADE])
-            opts.shadeMenubarOnlyWhenActive=false;
-
-        if(!itsActiveMdiColors)
-            itsActiveMdiColors=(QColor *)itsBackgroundCols;
-        if(!itsMdiColors)
-            itsMdiColors=(QColor *)itsBackgroundCols;
     }
 
-    return active ? itsActiveMdiColors : itsMdiColors;
+    QtCShades *shades(active ? itsActiveMdiColors : itsMdiColors);
+
+    return shades ? shades->cols : itsBackgroundCols;
 }
 
 #ifdef SET_MDI_WINDOW_BUTTON_POSITIONS
@@ -8603,9 +9274,7 @@ const QColor & QtCurveStyle::menuStripeCol(const QColorGroup &cg) const
         case SHADE_CUSTOM:
             return opts.customMenuStripeColor;
         case SHADE_BLEND_SELECTED:
-            // Hack! Use opts.customMenuStripeColor to store this setting!
-            if(IS_BLACK(opts.customMenuStripeColor))
-                opts.customMenuStripeColor=midColor(itsHighlightCols[ORIGINAL_SHADE], popupMenuCols(cg)[ORIGINAL_SHADE]);
+            // Set when the palette is polished...
             return opts.customMenuStripeColor;
         case SHADE_SELECTED:
             return itsHighlightCols[MENU_STRIPE_SHADE];
@@ -8656,29 +9325,35 @@ QPixmap * QtCurveStyle::getPixelPixmap(const QColor col) const
 
         img.setAlphaBuffer(true);
         img.setPixel(0, 0, qRgba(qRed(rgb), qGreen(rgb), qBlue(rgb), constAlpha));
-        pix=new QPixmap(img);
+        pix=new QPixmap;
+        itsUploader->upload(*pix, img);
         itsPixmapCache.insert(key, pix, pix->depth()/8);
     }
 
     return pix;
 }
 
-QPixmap * QtCurveStyle::createStripePixmap(const QColor &col, bool forWindow) const
+QPixmap QtCurveStyle::createStripePixmap(const QColor &col, bool forWindow) const
 {
+    // Window stripes are offset to line up with the titlebar - so all windows (and menus) with the
+    // same colour, and adjustment, share the same tile...
     QRgb    rgb(col.rgb());
-    QString key(createKey(rgb, forWindow ? 'S' : 's'));
-
+    int     adjust(forWindow ? qtcGetWindowBorderSize().titleHeight%4 : 0);
+    QString key(createKey(rgb, forWindow ? 'S' : 's', adjust));
     QPixmap *pix=itsPixmapCache.find(key);
 
-    if(!pix)
+    if(pix)
+        return *pix;
+
+    pix=new QPixmap(64, 64);
+
+    if(!findTile(*pix, key))
     {
         QColor col2(shade(col, BGND_STRIPE_SHADE));
-        int    i,
-               adjust=forWindow ? qtcGetWindowBorderSize().titleHeight%4 : 0;
+        int    i;
+
+        pix->fill(rgb);
 
-        pix=new QPixmap(64, 64);
-        pix->fill(col.rgb());
-        
         QPainter p;
         p.begin(pix);
         p.setPen(QColor((3*col.red()+col2.red())/4,
@@ -8694,21 +9369,246 @@ QPixmap * QtCurveStyle::createStripePixmap(const QColor &col, bool forWindow) co
         for (i=2; i<67; i+=4)
             p.drawLine(0, i-adjust, 63, i-adjust);
         p.end();
+        recordTile(key, *pix);
     }
 
-    return pix;
+    // Return a (shallow) copy, so that callers are not affected if the cache later deletes the tile...
+    QPixmap stripe(*pix);
+
+    if(!itsPixmapCache.insert(key, pix, pix->width()*pix->height()*(pix->depth()/8)))
+        delete pix;
+    return stripe;
+}
+
+// Upload a generated, or pre-rendered, tile - copying it from another process if possible...
+void QtCurveStyle::uploadTile(QPixmap &pix, const QString &key, const QImage &img) const
+{
+    // QImage is explicitly shared, so keep a copy - callers may reset or re-use theirs...
+    if(!itsAtlasFile.isEmpty())
+        itsAtlasImages[key]=img.copy();
+
+    if(!itsSharedPixmaps || !itsSharedPixmaps->fetch(pix, img))
+    {
+        itsUploader->upload(pix, img);
+        if(itsSharedPixmaps)
+            itsSharedPixmaps->publish(pix, img);
+    }
+}
+
+// Upload a tile from the atlas, if it is there...
+bool QtCurveStyle::findTile(QPixmap &pix, const QString &key) const
+{
+    QImage img;
+
+    if(!itsAtlas || !itsAtlas->find(key, img))
+        return false;
+
+    uploadTile(pix, key, img);
+    return true;
+}
+
+// Record a tile that was drawn via QPainter - its mask, if any, is stored as the image's alpha...
+void QtCurveStyle::recordTile(const QString &key, const QPixmap &pix) const
+{
+    if(itsAtlasFile.isEmpty())
+        return;
+
+    QImage img(pix.convertToImage().convertDepth(32));
+
+    if(pix.mask())
+    {
+        QImage mask(pix.mask()->convertToImage());
+
+        img.setAlphaBuffer(true);
+        for(int y=0; y<img.height(); ++y)
+        {
+            QRgb *l((QRgb *)img.scanLine(y));
+
+            for(int x=0; x<img.width(); ++x)
+                l[x]=qGray(mask.pixel(x, y))<128 ? (l[x]|0xFF000000) : 0;
+        }
+    }
+
+    itsAtlasImages[key]=img;
+}
+
+// The most likely menubar, toolbar, button, and tab sizes - as derived from the font height...
+#define WARMUP_MAX_COST (PIXMAP_CACHE_COST/2)
+#define WARMUP_WIDE     4096 // Menubars and toolbars are wider than the longest tile
+#define WARMUP_TAB_LEN  160  // Tabs up to this wide, along with each shorter tile length
+
+// Height of a push button - as per sizeFromContents, for a single line of text...
+int QtCurveStyle::warmUpButtonHeight(int fh) const
+{
+    return fh+(2*pixelMetric(PM_ButtonMargin))+(DO_EFFECT && !(opts.thin&THIN_BUTTONS) ? 6 : 4);
 }
 
-static QImage rotateImage(const QImage &img, double angle=90.0)
+void QtCurveStyle::startWarmUp()
 {
-    QWMatrix matrix;
-    matrix.translate(img.width()/2, img.height()/2);
-    matrix.rotate(angle);
+    QValueVector<WarmUp::Job> jobs;
+    const QColorGroup         &cg(QApplication::palette().active());
+    int                       fh(QFontMetrics(QApplication::font()).height()),
+                              cost(0),
+                              // A cached bevel's gradient is drawn within its border, and etching, across the
+                              // length of the pixmap that it is drawn into - see drawLightBevelCached...
+                              btnSize(warmUpButtonHeight(fh)-(DO_EFFECT ? 2 : 0)-2),
+                              tabSize(fh+pixelMetric(PM_TabBarTabVSpace));
+
+    addWarmUpJobs(jobs, cost, menuColors(cg, true)[ORIGINAL_SHADE], cg.background(), opts.menubarAppearance,
+                  WIDGET_OTHER, false, fh+4, fh+8, 1, WARMUP_WIDE);
+    addWarmUpJobs(jobs, cost, cg.background(), cg.background(), opts.toolbarAppearance, WIDGET_OTHER, false,
+                  26, 36, 2, WARMUP_WIDE);
+    addWarmUpJobs(jobs, cost, itsButtonCols[ORIGINAL_SHADE], cg.background(), opts.appearance,
+                  WIDGET_STD_BUTTON, false, btnSize, btnSize+2, 1, BEVEL_PIXMAP_LEN-2);
+
+    // Tabs are not cached as bevels, so their gradients are drawn across the whole tab - whose tile
+    // length depends upon the tab's width. Unselected tabs are 2 pixels shorter than the tab bar...
+    for(int length=WARMUP_TAB_LEN; length>=MAX_GRADIENT_TILES*PIXMAP_DIMENSION; length/=2)
+        for(int s=0; s<2; ++s)
+        {
+            QColor fill(getTabFill(0==s, false, itsBackgroundCols));
 
-    QRect newRect(matrix.mapRect(QRect(0, 0, img.width(), img.height())));
+            if(opts.tabBgnd)
+                fill=shade(fill, TO_FACTOR(opts.tabBgnd));
+            addWarmUpJobs(jobs, cost, fill, cg.background(), 0==s ? SEL_TAB_APP : NORM_TAB_APP, WIDGET_TAB_TOP,
+                          0==s, 0==s ? tabSize : tabSize-2, 0==s ? tabSize : tabSize-2, 1, length);
+        }
+
+    if(NULL!=getenv("QTCURVE_DEBUG"))
+        std::cout << "QtCurve: Warming up " << jobs.count() << " tiles (" << cost << " bytes)\n";
 
-    return img.xForm(QWMatrix(matrix.m11(), matrix.m12(), matrix.m21(), matrix.m22(),
-                              matrix.dx() - newRect.left(), matrix.dy() - newRect.top()));
+    itsWarmUp->start(jobs);
+}
+
+void QtCurveStyle::addWarmUpJobs(QValueVector<WarmUp::Job> &jobs, int &cost, const QColor &base, const QColor &bgnd,
+                                 EAppearance app, EWidget w, bool sel, int minSize, int maxSize, int step,
+                                 int length) const
+{
+    if(IS_FLAT(app))
+        return;
+
+    // As per drawBevelGradient...
+    if(APPEARANCE_BEVELLED==app && !WIDGET_BUTTON(w))
+        app=APPEARANCE_GRADIENT;
+
+    for(int size=minSize; size<=maxSize; size+=step)
+    {
+        WarmUp::Job job;
+        int         len(gradientTileLength(length, size)),
+                    bytes(len*size*4);
+        bool        useBgnd,
+                    argb;
+        QImage      img;
+
+        job.key=gradientKey(base, bgnd, size, len, true, sel, app, w, useBgnd, argb);
+
+        // ARGB tiles are composited onto their background, so are left until they are first drawn...
+        if(argb || cost+bytes>WARMUP_MAX_COST || itsPixmapCache.find(job.key, false) ||
+           (itsAtlas && itsAtlas->find(job.key, img)))
+            continue;
+
+        job.base=base;
+        job.bgnd=bgnd;
+        job.r=QRect(0, 0, len, size);
+        job.horiz=true;
+        job.sel=sel;
+        job.app=app;
+        job.widget=w;
+        cost+=bytes;
+        jobs.append(job);
+    }
+}
+
+// Called on the warm-up thread - so this must only write to img...
+void QtCurveStyle::renderWarmUpTile(const QColor &base, const QColor &bgnd, const QRect &r, bool horiz, bool sel,
+                                    int app, int w, QImage &img) const
+{
+    drawBevelGradientReal(base, bgnd, 0L, r, horiz, sel, (EAppearance)app, (EWidget)w, &img);
+}
+
+void QtCurveStyle::addWarmUpTile(const QString &key, const QImage &img)
+{
+    if(itsPixmapCache.find(key, false))
+        return;
+
+    QPixmap *pix=new QPixmap(img.width(), img.height());
+
+    uploadTile(*pix, key, img);
+    if(!itsPixmapCache.insert(key, pix, tileCost(*pix)))
+        delete pix;
+}
+
+// Indicators, arrows, and button bevels are cached as they are first drawn - so draw their common
+// states...
+void QtCurveStyle::warmUpPrimitives()
+{
+    const QColorGroup &cg(QApplication::palette().active());
+    int               iw(pixelMetric(PM_IndicatorWidth)),
+                      ih(pixelMetric(PM_IndicatorHeight)),
+                      ew(pixelMetric(PM_ExclusiveIndicatorWidth)),
+                      eh(pixelMetric(PM_ExclusiveIndicatorHeight));
+    QPixmap           pix(QMAX(QMAX(iw, ew), 16), QMAX(QMAX(ih, eh), 16));
+    QPainter          p(&pix);
+
+    for(int s=0; s<3; ++s)
+    {
+        SFlags state(Style_Enabled|(0==s ? Style_On : 1==s ? Style_Off : Style_NoChange));
+
+        drawPrimitive(PE_Indicator, &p, QRect(0, 0, iw, ih), cg, state);
+        if(s<2)
+            drawPrimitive(PE_ExclusiveIndicator, &p, QRect(0, 0, ew, eh), cg, state);
+    }
+
+    for(int a=0; a<4; ++a)
+        drawPrimitive(0==a ? PE_ArrowUp : 1==a ? PE_ArrowDown : 2==a ? PE_ArrowLeft : PE_ArrowRight, &p,
+                      QRect(0, 0, 16, 16), cg, Style_Enabled);
+    p.end();
+
+    // The bevel's caps and tile do not depend upon the button's width...
+    int     bh(warmUpButtonHeight(QFontMetrics(QApplication::font()).height()));
+    QPixmap btn(BEVEL_PIXMAP_LEN*2, bh+2);
+
+    p.begin(&btn);
+    for(int h=bh; h<=bh+2; ++h)
+        for(int s=0; s<2; ++s)
+            drawPrimitive(PE_ButtonCommand, &p, QRect(0, 0, btn.width(), h), cg,
+                          Style_Enabled|(0==s ? Style_Raised : Style_Down));
+    p.end();
+}
+
+// Hash of the settings that affect the contents of atlas tiles, but which are not part of their
+// keys - i.e. the shading routine, the custom gradients, how tabs are coloured, and how bevels,
+// indicators, arrows, and markers are drawn...
+unsigned int QtCurveStyle::atlasSignature() const
+{
+    QString      sig;
+    QTextOStream str(&sig);
+
+    str << VERSION << '-' << opts.colorSelTab << '-' << opts.invertBotTab << '-' << opts.contrast << '-'
+        << opts.highlightFactor << '-' << opts.round << '-' << opts.square << '-' << opts.thin << '-'
+        << opts.buttonEffect << '-' << opts.coloredMouseOver << '-' << opts.coloredTbarMo << '-'
+        << opts.colorSliderMouseOver << '-' << opts.focus << '-' << opts.defBtnIndicator << '-'
+        << opts.sunkenAppearance << '-' << opts.sliderStyle << '-' << opts.crSize << '-' << opts.crButton << '-'
+        << opts.crHighlight << '-' << opts.xCheck << '-' << opts.smallRadio << '-' << opts.fadeLines;
+    for(int i=0; i<4; ++i)
+        str << '-' << shade(QColor(128, 128, 128), 0.6+(i*0.25)).rgb();
+    for(int app=0; app<APPEARANCE_FLAT; ++app)
+    {
+        const Gradient                   *grad=qtcGetGradient((EAppearance)app, &opts);
+        GradientStopCont::const_iterator it(grad->stops.begin()),
+                                         end(grad->stops.end());
+
+        str << '-' << app << ':' << grad->border;
+        for(; it!=end; ++it)
+            str << ',' << (*it).pos << ',' << (*it).val << ',' << (*it).alpha;
+    }
+
+    unsigned int hash=2166136261U;
+
+    for(unsigned int i=0; i<sig.length(); ++i)
+        hash=(hash^sig[i].unicode())*16777619U;
+
+    return hash;
 }
 
 static void recolour(QImage &img, const QColor &col, double shade)
@@ -8721,66 +9621,271 @@ static void recolour(QImage &img, const QColor &col, double shade)
 
 void QtCurveStyle::drawDot(QPainter *p, const QRect &r, const QColor *cols) const
 {
-    QPixmap *pix=getPixmap(cols[STD_BORDER], PIX_DOT, 0.9);
-    p->drawPixmap(r.x()+((r.width()-pix->width())>>1), r.y()+((r.height()-pix->height())>>1), *pix);
+    const QtCImage &img(constImages[IMG_DOT]);
+
+    drawImage(p, r.x()+((r.width()-img.width)>>1), r.y()+((r.height()-img.height)>>1), cols[STD_BORDER], PIX_DOT, 0.9);
 }
 
-QPixmap * QtCurveStyle::getPixmap(const QColor col, EPixmap p, double shade) const
+void QtCurveStyle::drawLines(QPainter *p, const QRect &r, bool horiz, int nLines, int offset,
+                             const QColor *cols, int startOffset, int dark, ELine type) const
 {
-    QRgb    rgb(col.rgb());
-    QString key(createKey(rgb, p));
-    QPixmap *pix=itsPixmapCache.find(key);
+    if(!drawCachedMarkers(p, r, horiz, nLines, offset, cols, startOffset, dark, type, false))
+        ::drawLines(p, r, horiz, nLines, offset, cols, startOffset, dark, type);
+}
+
+void QtCurveStyle::drawDots(QPainter *p, const QRect &r, bool horiz, int nLines, int offset,
+                            const QColor *cols, int startOffset, int dark) const
+{
+    if(!drawCachedMarkers(p, r, horiz, nLines, offset, cols, startOffset, dark, LINE_DOTS, true))
+        ::drawDots(p, r, horiz, nLines, offset, cols, startOffset, dark);
+}
+
+// Handle markers are drawn as many single pixel lines, or dots. The pattern of each colour repeats
+// along the marker, so a strip of it is cached (independent of the marker's length) and tiled - the
+// lighter colour being the same pattern, 1 pixel further across (and, if etched or dotted, along).
+bool QtCurveStyle::drawCachedMarkers(QPainter *p, const QRect &r, bool horiz, int nLines, int offset,
+                                     const QColor *cols, int startOffset, int dark, ELine type, bool dots) const
+{
+    if(nLines<1)
+        return false;
+
+    // As per ::drawLines and ::drawDots...
+    int step(dots || LINE_DASHES!=type ? 3 : 2),
+        space((nLines*2)+(dots || LINE_DASHES!=type ? (nLines-1) : 0)),
+        across(horiz ? r.y()+((r.height()-space)>>1) : r.x()+((r.width()-space)>>1)),
+        along((horiz ? r.x() : r.y())+offset),
+        len(dots
+                ? 3*((horiz ? (r.width()-(2*offset))/3 : (r.height()-(2*offset))/3))+1
+                : (horiz ? r.width() : r.height())-(2*offset)),
+        disp(dots || LINE_SUNKEN==type ? 1 : 0),
+        thickness(((nLines-1)*step)+1);
+
+    if(len<1)
+        return false;
+
+    if(startOffset && across+startOffset>0)
+        across+=startOffset;
+
+    // The strip may be evicted when the next is inserted, so each colour is drawn before the next is
+    // looked up...
+    for(int i=0; i<(dots || LINE_FLAT!=type ? 2 : 1); ++i)
+    {
+        QPixmap *strip(getMarkerStrip(dots, horiz, nLines, step, i ? cols[0] : cols[dark]));
+        int     a(along+(i ? disp : 0)),
+                c(across+i);
+
+        if(horiz)
+            p->drawTiledPixmap(a, c, len, thickness, *strip);
+        else
+            p->drawTiledPixmap(c, a, thickness, len, *strip);
+    }
+    return true;
+}
+
+QPixmap * QtCurveStyle::getMarkerStrip(bool dots, bool horiz, int nLines, int step, const QColor &col) const
+{
+    QString key(createKey(dots ? 'D' : 'L', horiz, nLines, step, MARKER_STRIP_LEN, col.rgb()));
+    QPixmap *pix(itsPixmapCache.find(key));
 
     if(!pix)
     {
-        pix=new QPixmap();
+        pix=new QPixmap;
+
+        if(!findTile(*pix, key))
+        {
+            int    thickness(((nLines-1)*step)+1);
+            QImage img(horiz ? MARKER_STRIP_LEN : thickness, horiz ? thickness : MARKER_STRIP_LEN, 32);
+            QRgb   rgb(col.rgb()|0xFF000000);
+
+            // The pattern is built client side, and uploaded (along with its mask) in one go...
+            img.setAlphaBuffer(true);
+            img.fill(0);
+            for(int l=0; l<nLines; ++l)
+                for(int i=0; i<MARKER_STRIP_LEN; i+=(dots ? 3 : 1))
+                    if(horiz)
+                        img.setPixel(i, l*step, rgb);
+                    else
+                        img.setPixel(l*step, i, rgb);
 
-        QImage img;
+            uploadTile(*pix, key, img);
+        }
+        itsPixmapCache.insert(key, pix, pix->width()*pix->height()*((pix->depth()/8)+1));
+    }
+
+    return pix;
+}
 
-        switch(p)
+static EImage pixmapImage(EPixmap p, const Options &opts)
+{
+    switch(p)
+    {
+        case PIX_RADIO_BORDER:
+            return IMG_RADIO_FRAME;
+        case PIX_RADIO_INNER:
+            return IMG_RADIO_INNER;
+        case PIX_RADIO_LIGHT:
+            return IMG_RADIO_LIGHT;
+        case PIX_RADIO_ON:
+            return opts.smallRadio ? IMG_RADIO_ON_SMALL : IMG_RADIO_ON;
+        case PIX_CHECK:
+            return opts.xCheck ? IMG_CHECK_X_ON : IMG_CHECK_ON;
+        case PIX_SLIDER:
+            return IMG_SLIDER;
+        case PIX_SLIDER_LIGHT:
+            return IMG_SLIDER_LIGHT;
+        case PIX_SLIDER_V:
+            return IMG_SLIDER_V;
+        case PIX_SLIDER_LIGHT_V:
+            return IMG_SLIDER_LIGHT_V;
+        case PIX_DOT:
+            return IMG_DOT;
+        default:
+            return NUM_IMAGES;
+    }
+}
+
+static QImage toImage(EImage image)
+{
+    QImage img;
+
+    if(NUM_IMAGES!=image)
+    {
+        const QtCImage &src(constImages[image]);
+
+        img.create(src.width, src.height, 32);
+        img.setAlphaBuffer(true);
+        for(int y=0; y<src.height; ++y)
+            memcpy(img.scanLine(y), src.data+(y*src.width), src.width*sizeof(QRgb));
+    }
+
+    return img;
+}
+
+#ifdef QTC_USE_XRENDER
+// Upload the alpha of an embedded image as an A8 picture...
+static Qt::HANDLE createAlphaMask(const QtCImage &img)
+{
+    Display           *dpy(qt_xdisplay());
+    XRenderPictFormat *format(XRenderFindStandardFormat(dpy, PictStandardA8));
+
+    if(!format)
+        return 0;
+
+    // XPutImage wants 8-bit rows padded to 4 bytes...
+    int      stride((img.width+3)&~3);
+    char     *data((char *)calloc(stride*img.height, 1));
+    Pixmap   pm(XCreatePixmap(dpy, qt_xrootwin(), img.width, img.height, 8));
+    GC       gc(XCreateGC(dpy, pm, 0, 0L));
+    XImage   *xi;
+
+    for(int y=0; y<img.height; ++y)
+        for(int x=0; x<img.width; ++x)
+            data[(y*stride)+x]=qAlpha(img.data[(y*img.width)+x]);
+
+    xi=XCreateImage(dpy, (Visual *)QPaintDevice::x11AppVisual(), 8, ZPixmap, 0, data, img.width, img.height, 32, stride);
+    XPutImage(dpy, pm, gc, xi, 0, 0, 0, 0, img.width, img.height);
+    XDestroyImage(xi); // Also frees data
+    XFreeGC(dpy, gc);
+
+    Picture pic(XRenderCreatePicture(dpy, pm, format, 0, 0L));
+
+    XFreePixmap(dpy, pm);
+    return pic;
+}
+#endif
+
+// The embedded images are only alpha masks. If XRender is in use, and we are drawing into a pixmap, then
+// each is uploaded once, and composited through in the required colour - so no per-colour copies are
+// made. Otherwise, a coloured copy is drawn via getPixmap().
+void QtCurveStyle::drawImage(QPainter *p, int x, int y, const QColor &col, EPixmap pix, double shade) const
+{
+#ifdef QTC_USE_XRENDER
+    // Qt3 applies a widget's paint event region to the painter's GCs, and not to the painter - so
+    // compositing straight onto a widget would draw outside of the update region, and re-blend (and
+    // so darken) the anti-aliased edges on partial repaints...
+    Qt::HANDLE dest(useXRender() && p->device() && QInternal::Widget!=p->device()->devType()
+                        ? p->device()->x11RenderHandle() : 0);
+
+    // Only plain translations can be composited directly...
+    if(dest && !p->hasViewXForm() && Qt::CopyROP==p->rasterOp() &&
+       (!p->hasWorldXForm() || (1.0==p->worldMatrix().m11() && 1.0==p->worldMatrix().m22() &&
+                                0.0==p->worldMatrix().m12() && 0.0==p->worldMatrix().m21())))
+    {
+        EImage image(pixmapImage(pix, opts));
+
+        if(NUM_IMAGES==image)
+            return;
+
+        Display                         *dpy(qt_xdisplay());
+        QMap<int, Qt::HANDLE>::Iterator it(itsImageMasks.find(image));
+        const QtCImage                  &img(constImages[image]);
+
+        if(it==itsImageMasks.end())
+            it=itsImageMasks.insert(image, createAlphaMask(img));
+
+        if(!itsSolidFill)
         {
-            case PIX_RADIO_BORDER:
-                img.loadFromData(qembed_findData("radio_frame.png"));
-                break;
-            case PIX_RADIO_INNER:
-                img.loadFromData(qembed_findData("radio_inner.png"));
-                break;
-            case PIX_RADIO_LIGHT:
-                img.loadFromData(qembed_findData("radio_light.png"));
-                break;
-            case PIX_RADIO_ON:
-                img.loadFromData(qembed_findData(opts.smallRadio ? "radio_on_small.png" : "radio_on.png"));
-                break;
-            case PIX_CHECK:
-                img.loadFromData(qembed_findData(opts.xCheck ? "check_x_on.png" : "check_on.png"));
-                break;
-            case PIX_SLIDER:
-                img.loadFromData(qembed_findData("slider.png"));
-                break;
-            case PIX_SLIDER_LIGHT:
-                img.loadFromData(qembed_findData("slider_light.png"));
-                break;
-            case PIX_SLIDER_V:
-                img.loadFromData(qembed_findData("slider.png"));
-                img=rotateImage(img);
-                break;
-            case PIX_SLIDER_LIGHT_V:
-                img.loadFromData(qembed_findData("slider_light.png"));
-                img=rotateImage(img).mirror(true, false);
-                break;
-            case PIX_DOT:
-                img.loadFromData(qembed_findData("dot.png"));
-                break;
-            default:
-                break;
+            // A 1x1 repeating source, that is filled with the required colour...
+            Pixmap                   pm(XCreatePixmap(dpy, qt_xrootwin(), 1, 1, 32));
+            XRenderPictureAttributes pa;
+
+            pa.repeat=True;
+            itsSolidFill=XRenderCreatePicture(dpy, pm, XRenderFindStandardFormat(dpy, PictStandardARGB32),
+                                              CPRepeat, &pa);
+            XFreePixmap(dpy, pm);
+        }
+
+        if(it.data() && itsSolidFill)
+        {
+            // Colour as per the client side path - i.e. as if applied to a single opaque pixel...
+            QRgb         rgb(0xFF000000);
+            XRenderColor c;
+            QPoint       pt(p->xForm(QPoint(x, y)));
+            bool         clipped(p->hasClipping());
+
+            qtcAdjustPix((unsigned char *)&rgb, 4, 1, 1, 4, col.red(), col.green(), col.blue(), shade);
+            c.red=qRed(rgb)*0x101;
+            c.green=qGreen(rgb)*0x101;
+            c.blue=qBlue(rgb)*0x101;
+            c.alpha=0xFFFF;
+            XRenderFillRectangle(dpy, PictOpSrc, itsSolidFill, &c, 0, 0, 1, 1);
+
+            if(clipped)
+                XRenderSetPictureClipRegion(dpy, dest, p->clipRegion(QPainter::CoordDevice).handle());
+            XRenderComposite(dpy, PictOpOver, itsSolidFill, it.data(), dest, 0, 0, 0, 0, pt.x(), pt.y(),
+                             img.width, img.height);
+            if(clipped)
+            {
+                XRenderPictureAttributes pa;
+
+                pa.clip_mask=None;
+                XRenderChangePicture(dpy, dest, CPClipMask, &pa);
+            }
+            return;
         }
+    }
+#endif
 
-        if (img.depth()<32)
-            img=img.convertDepth(32);
+    p->drawPixmap(x, y, *getPixmap(col, pix, shade));
+}
 
+// Where they cannot be composited, the embedded images are colourised for each colour used. These
+// coloured copies are kept in their own cache, with a fixed budget, so that the memory used does not
+// grow with the number of colours - the colour independent images themselves are in constImages.
+QPixmap * QtCurveStyle::getPixmap(const QColor col, EPixmap p, double shade) const
+{
+    QRgb    rgb(col.rgb());
+    QString key(createKey(rgb, p));
+    QPixmap *pix=itsColoredImageCache.find(key);
+
+    if(!pix)
+    {
+        QImage img(toImage(pixmapImage(p, opts)));
+
+        pix=new QPixmap();
         qtcAdjustPix(img.bits(), 4, img.width(), img.height(), img.bytesPerLine(), col.red(), col.green(), col.blue(), shade);
-        pix->convertFromImage(img);
-        itsPixmapCache.insert(key, pix, pix->depth()/8);
+        itsUploader->upload(*pix, img);
+        itsColoredImageCache.insert(key, pix, QMAX(1, pix->width()*pix->height()*(pix->depth()/8)));
     }
 
     return pix;
@@ -8806,6 +9911,15 @@ void QtCurveStyle::setSbType()
     }
 }
 
+void QtCurveStyle::repaintWidget(QWidget *widget, const char *reason, bool now)
+{
+    if(!itsRepaintMonitor || itsRepaintMonitor->invalidate(widget, reason))
+        if(now)
+            widget->repaint(false);
+        else
+            widget->update();
+}
+
 void QtCurveStyle::resetHover()
 {
     itsIsSpecialHover=false;
@@ -8861,7 +9975,7 @@ void QtCurveStyle::updateProgressPos()
             // update animation Offset of the current Widget
             it.data() = (it.data() + (QApplication::reverseLayout() ? -1 : 1))
                         % (PROGRESS_CHUNK_WIDTH*2);
-            pb->update();
+            repaintWidget(pb, "progress animation", false);
         }
         if(pb->isVisible())
             visible = true;
@@ -8880,7 +9994,7 @@ void QtCurveStyle::sliderThumbMoved(int)
     QSlider *slider(::qt_cast<QSlider*>(sender()));
 
     if(slider)
-        slider->update();
+        repaintWidget(slider, "slider", false);
 }
 
 void QtCurveStyle::khtmlWidgetDestroyed(QObject *o)
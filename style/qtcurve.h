@@ -61,9 +61,12 @@
 #include <qpoint.h>
 #include <qpalette.h>
 #include <qpixmap.h>
+#include <qimage.h>
 #include <qcache.h>
 #include <qvaluelist.h>
+#include <qshared.h>
 #include "common.h"
+#include "warmup.h"
 
 class QTimer;
 class QSlider;
@@ -75,6 +78,23 @@ class QSlider;
 #endif
 
 class ShortcutHandler;
+class PaintFlash;
+class RepaintMonitor;
+class WindowProperties;
+class ImageUploader;
+class SharedPixmaps;
+class Atlas;
+
+//
+// Reference counted set of shades, all derived from cols[ORIGINAL_SHADE]. Sets are interned by
+// QtCurveStyle::internShades(), so several colour roles (e.g. slider and default button) may
+// share the one set.
+class QtCShades : public QShared
+{
+    public:
+
+    QColor cols[TOTAL_SHADES+1];
+};
 
 class QtCurveStyle : public BASE_STYLE
 {
@@ -160,6 +180,10 @@ class QtCurveStyle : public BASE_STYLE
                         EntryColor coloration, int round, EWidget=WIDGET_ENTRY) const;
     void drawArrow(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags,
                    QStyle::PrimitiveElement pe,  bool small=false, bool checkActive=false) const;
+    void drawCheckBox(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags) const;
+    void drawRadioButton(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags) const;
+    bool drawCachedIndicator(PrimitiveElement pe, QPainter *p, const QRect &r, const QColorGroup &cg,
+                             SFlags flags) const;
     void drawPrimitive(PrimitiveElement, QPainter *, const QRect &, const QColorGroup &,
                        SFlags = Style_Default, const QStyleOption & = QStyleOption::Default) const;
     void drawKStylePrimitive(KStylePrimitive kpe, QPainter* p, const QWidget* widget, const QRect &r,
@@ -193,27 +217,59 @@ class QtCurveStyle : public BASE_STYLE
                       bool mbi, int round, const QColor &bgnd, const QColor *cols) const;
     void drawProgress(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags, int round,
                       const QWidget *widget) const;
+    bool drawLightBevelCached(const QColor &bgnd, QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags,
+                              int round, const QColor &fill, const QColor *custom, bool doBorder, bool doCorners,
+                              EWidget w, EAppearance app, bool doEtch, bool glowFocus) const;
+    void drawLightBevelReal(const QColor &bgnd, QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags,
+                            int round, const QColor &fill, const QColor *custom, bool doBorder, bool doCorners,
+                            EWidget w, EAppearance app, bool doEtch, bool glowFocus) const;
     void drawBevelGradient(const QColor &base, const QColor &bgnd, QPainter *p, QRect const &r,
                            bool horiz, bool sel, EAppearance bevApp, EWidget w=WIDGET_OTHER) const;
     void drawBevelGradientReal(const QColor &base, const QColor &bgnd, QPainter *p, QRect const &r,
-                               bool horiz, bool sel, EAppearance bevApp, EWidget w=WIDGET_OTHER) const;
+                               bool horiz, bool sel, EAppearance bevApp, EWidget w=WIDGET_OTHER, QImage *img=0L) const;
     void drawGradient(const QColor &top, const QColor &bot, QPainter *p, const QRect &r, bool horiz=true) const;
     void drawSbSliderHandle(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags, bool slider=false) const;
     void drawSliderHandle(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags, QSlider *slider, bool tb=false) const;
     void drawSliderGroove(QPainter *p, const QRect &r, const QColorGroup &cg, SFlags flags,
                           const QWidget *widget) const;
-    void drawMenuOrToolBarBackground(QPainter *p, const QRect &r, const QColorGroup &cg, bool menu=true, bool horiz=true) const;
+    void drawMenuOrToolBarBackground(QPainter *p, const QRect &r, const QColorGroup &cg, bool menu=true, bool horiz=true,
+                                     bool active=true) const;
     void drawHandleMarkers(QPainter *p, const QRect &r, SFlags flags, bool tb, ELine handles) const;
     void drawHighlight(QPainter *p, const QRect &r, const QColorGroup &cg, bool horiz, bool inc) const;
 
     private:
 
+    enum EShadeSet
+    {
+        SHADES_SLIDER,
+        SHADES_DEF_BTN,
+        SHADES_COMBO_BTN,
+        SHADES_SORTED_LV,
+        SHADES_CHECK_RADIO_SEL,
+        SHADES_PROGRESS,
+        SHADES_SIDEBAR_BUTTONS,
+        SHADES_POPUP_MENU,
+
+        NUM_SHADE_SETS
+    };
+
     static QColor shadowColor(const QColor col)
     {
         return qGray(col.rgb()) < 100 ? QColor(255, 255, 255) : QColor(0, 0, 0);
     }
 
     void           shadeColors(const QColor &base, QColor *vals) const;
+    const QColor * derivedColors(EShadeSet set) const;
+    QtCShades *    internShades(const QColor &base) const;
+    void           releaseShades(QtCShades *&shades) const;
+    void           releaseShades();
+    void           pruneShades();
+    const QColor * sliderCols() const        { return derivedColors(SHADES_SLIDER); }
+    const QColor * defBtnCols() const        { return derivedColors(SHADES_DEF_BTN); }
+    const QColor * comboBtnCols() const      { return derivedColors(SHADES_COMBO_BTN); }
+    const QColor * sortedLvCols() const      { return derivedColors(SHADES_SORTED_LV); }
+    const QColor * checkRadioSelCols() const { return derivedColors(SHADES_CHECK_RADIO_SEL); }
+    const QColor * progressCols() const      { return derivedColors(SHADES_PROGRESS); }
     const QColor * buttonColors(const QColorGroup &cg) const;
     const QColor * popupMenuCols(const QColorGroup &cg) const;
     const QColor & popupMenuCol(const QColorGroup &cg, int shade=ORIGINAL_SHADE) const;
@@ -228,7 +284,9 @@ class QtCurveStyle : public BASE_STYLE
     void           setMenuTextColors(QWidget *widget, bool isMenuBar) const;
     const QColor * menuColors(const QColorGroup &cg, bool active) const;
     void           setDecorationColors(bool init=false);
+    void           updatePaletteKey();
     const QColor * getMdiColors(const QColorGroup &cg, bool active) const;
+    bool           isActiveMenuBar(const QWidget *widget) const;
 #ifdef SET_MDI_WINDOW_BUTTON_POSITIONS
     void           readMdiPositions() const;
 #endif
@@ -241,12 +299,38 @@ class QtCurveStyle : public BASE_STYLE
     QColor         shade(const QColor &a, float k) const;
     void           shade(const color &ca, color *cb, double k) const;
     void           drawDot(QPainter *p, const QRect &r, const QColor *cols) const;
+    void           drawLines(QPainter *p, const QRect &r, bool horiz, int nLines, int offset,
+                             const QColor *cols, int startOffset, int dark, ELine type) const;
+    void           drawDots(QPainter *p, const QRect &r, bool horiz, int nLines, int offset,
+                            const QColor *cols, int startOffset, int dark) const;
+    bool           drawCachedMarkers(QPainter *p, const QRect &r, bool horiz, int nLines, int offset,
+                                     const QColor *cols, int startOffset, int dark, ELine type, bool dots) const;
+    QPixmap *      getMarkerStrip(bool dots, bool horiz, int nLines, int step, const QColor &col) const;
     QPixmap *      getPixelPixmap(const QColor col) const;
+    void           drawImage(QPainter *p, int x, int y, const QColor &col, EPixmap pix, double shade=1.0) const;
     QPixmap *      getPixmap(const QColor col, EPixmap pix, double shade=1.0) const;
-    QPixmap *      createStripePixmap(const QColor &col, bool forWindow) const;
+    QPixmap        createStripePixmap(const QColor &col, bool forWindow) const;
+    unsigned int   atlasSignature() const;
+    QString        gradientKey(const QColor &base, const QColor &bgnd, int size, int len, bool horiz, bool sel,
+                               EAppearance app, EWidget w, bool &useBgnd, bool &argb) const;
+    int            warmUpButtonHeight(int fh) const;
+    void           startWarmUp();
+    void           addWarmUpJobs(QValueVector<WarmUp::Job> &jobs, int &cost, const QColor &base, const QColor &bgnd,
+                                 EAppearance app, EWidget w, bool sel, int minSize, int maxSize, int step,
+                                 int length) const;
+    void           renderWarmUpTile(const QColor &base, const QColor &bgnd, const QRect &r, bool horiz, bool sel,
+                                    int app, int w, QImage &img) const;
+    void           addWarmUpTile(const QString &key, const QImage &img);
+    void           warmUpPrimitives();
+    void           uploadTile(QPixmap &pix, const QString &key, const QImage &img) const;
+    bool           findTile(QPixmap &pix, const QString &key) const;
+    void           recordTile(const QString &key, const QPixmap &pix) const;
     void           setSbType();
     bool           isFormWidget(const QWidget *w) const { return itsKhtmlWidgets.contains(w); }
     void           resetHover();
+    void           repaintWidget(QWidget *widget, const char *reason, bool now=true);
+    void           emitMenuSize(const QWidget *widget, unsigned short size);
+    void           setBgndProp(QWidget *widget, unsigned short app);
     bool           isWindowDragWidget(QObject *o, const QPoint &pos=QPoint());
 
     private slots:
@@ -259,36 +343,39 @@ class QtCurveStyle : public BASE_STYLE
 
     private:
 
-    mutable Options            opts;
+    Options                    opts;
     QColor                     itsHighlightCols[TOTAL_SHADES+1],
                                itsBackgroundCols[TOTAL_SHADES+1],
                                itsMenubarCols[TOTAL_SHADES+1],
                                itsFocusCols[TOTAL_SHADES+1],
-                               *itsPopupMenuCols,
-                               *itsSliderCols,
-                               *itsDefBtnCols,
-                               *itsMouseOverCols,
-                               *itsComboBtnCols,
-                               *itsCheckRadioSelCols,
-                               *itsSortedLvColors,
-                               *itsProgressCols,
                                itsButtonCols[TOTAL_SHADES+1],
                                itsCheckRadioCol;
-    mutable QColor             *itsSidebarButtonsCols;
-    mutable QColor             *itsActiveMdiColors;
-    mutable QColor             *itsMdiColors;
+    const QColor               *itsMouseOverCols;
+    QtCShades                  *itsMouseOverShades;
+    mutable QMap<QString, QtCShades *> itsShadeStore;
+    mutable QtCShades          *itsShadeSets[NUM_SHADE_SETS];
+    mutable const QColor       *itsDerivedCols[NUM_SHADE_SETS];
+    mutable unsigned int       itsResolvedShades;
+    QString                    itsPaletteKey;
+    mutable QtCShades          *itsActiveMdiColors;
+    mutable QtCShades          *itsMdiColors;
+    mutable bool               itsReadMdiColors;
     mutable QColor             itsActiveMdiTextColor;
     mutable QColor             itsMdiTextColor;
     mutable QColor             itsColoredButtonCols[TOTAL_SHADES+1];
     mutable QColor             itsColoredBackgroundCols[TOTAL_SHADES+1];
     EApp                       itsThemedApp;
     mutable QCache<QPixmap>    itsPixmapCache;
+    mutable QCache<QPixmap>    itsColoredImageCache;
+    mutable QMap<int, Qt::HANDLE> itsImageMasks;
+    mutable Qt::HANDLE         itsSolidFill;
+    QString                    itsBgndTileKey;
+    QPixmap                    itsBgndTile;
 #if defined QTC_QT_ONLY || !defined KDE_VERSION || KDE_VERSION >= 0x30200
     bool                       itsIsTransKicker;
 #endif
     EHover                     itsHover;
     QPoint                     itsOldPos;
-    mutable bool               itsFormMode;
     QWidget                    *itsHoverWidget;
     int                        itsHoverSect;
     QTab                       *itsHoverTab;
@@ -296,12 +383,23 @@ class QtCurveStyle : public BASE_STYLE
     QMap<QWidget*, int>        itsProgAnimWidgets;
     QMap<const QWidget*, bool> itsKhtmlWidgets;
     QTimer                     *itsAnimationTimer;
-    mutable bool               itsActive,
-                               itsIsSpecialHover;
+    bool                       itsIsSpecialHover;
     mutable QValueList<int>    itsMdiButtons[2]; // 0=left, 1=right
     QWidget                    *itsDragWidget;
     bool                       itsDragWidgetHadMouseTracking;
     ShortcutHandler            *itsShortcutHandler;
+    PaintFlash                 *itsPaintFlash;
+    RepaintMonitor             *itsRepaintMonitor;
+    WindowProperties           *itsWindowProperties;
+    bool                       itsLowBandwidth;
+    ImageUploader              *itsUploader;
+    SharedPixmaps              *itsSharedPixmaps;
+    Atlas                      *itsAtlas;
+    QString                    itsAtlasFile;
+    mutable QMap<QString, QImage> itsAtlasImages;
+    WarmUp                     *itsWarmUp;
+
+    friend class WarmUp;
 };
 
 #endif
@@ -0,0 +1,200 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "recorder.h"
+
+#ifdef QTC_ENABLE_PROFILER
+
+#include <qwidget.h>
+#include <qpainter.h>
+#include <qapplication.h>
+#include <qmetaobject.h>
+#include <stdlib.h>
+#include <string.h>
+
+static QtCRecorder *theRecorder=0L;
+static int         theDepth=0;
+
+// Which options can be stored as values, and which refer to other objects...
+static ETraceOption optionKind(QtCProfiler::ECategory cat, int element, const QStyleOption &opt)
+{
+    if(opt.isDefault())
+        return OPT_DEFAULT;
+
+    switch(cat)
+    {
+        case QtCProfiler::CAT_PRIMITIVE:
+            switch(element)
+            {
+                case QStyle::PE_FocusRect:
+                    return OPT_COLOR;
+                case QStyle::PE_CheckListController:
+                case QStyle::PE_CheckListIndicator:
+                case QStyle::PE_CheckListExclusiveIndicator:
+                    return OPT_OTHER;
+                default:
+                    break;
+            }
+            break;
+        case QtCProfiler::CAT_CONTROL:
+            switch(element)
+            {
+                case QStyle::CE_PopupMenuItem:
+                case QStyle::CE_MenuBarItem:
+                case QStyle::CE_TabBarTab:
+                case QStyle::CE_TabBarLabel:
+                    return OPT_OTHER;
+                default:
+                    break;
+            }
+            break;
+        case QtCProfiler::CAT_COMPLEX_CONTROL:
+            if(QStyle::CC_ListView==element)
+                return OPT_OTHER;
+            break;
+        default:
+            break;
+    }
+
+    return OPT_INTS;
+}
+
+// The nearest Qt class - as the replayer cannot create application, or KDE, classes...
+static const char * qtClassName(const QWidget *widget)
+{
+    for(QMetaObject *mo=widget->metaObject(); mo; mo=mo->superClass())
+        if('Q'==mo->className()[0])
+            return mo->className();
+    return widget->className();
+}
+
+QtCRecorder * QtCRecorder::instance()
+{
+    static bool checked=false;
+
+    if(!checked)
+    {
+        const char *env=getenv("QTCURVE_RECORD");
+
+        checked=true;
+        if(env)
+        {
+            theRecorder=new QtCRecorder(QFile::decodeName(env));
+            if(IO_Ok==theRecorder->itsFile.status() && theRecorder->itsFile.isOpen())
+                qAddPostRoutine(cleanup);
+            else
+            {
+                delete theRecorder;
+                theRecorder=0L;
+            }
+        }
+    }
+
+    return theRecorder;
+}
+
+QtCRecorder::QtCRecorder(const QString &file)
+           : itsFile(file)
+{
+    if(itsFile.open(IO_WriteOnly|IO_Truncate))
+    {
+        itsStream.setDevice(&itsFile);
+        itsStream.writeRawBytes(QTC_TRACE_MAGIC, strlen(QTC_TRACE_MAGIC));
+        itsStream << (Q_UINT32)QTC_TRACE_VERSION;
+    }
+}
+
+void QtCRecorder::cleanup()
+{
+    if(theRecorder)
+    {
+        theRecorder->itsFile.close();
+        delete theRecorder;
+        theRecorder=0L;
+    }
+}
+
+void QtCRecorder::record(QtCProfiler::ECategory cat, int element, const QWidget *widget, const QPainter *p,
+                         const QRect &r, const QColorGroup &cg, unsigned int flags, unsigned int controls,
+                         unsigned int active, const QStyleOption &opt)
+{
+    if(!widget && p && p->device())
+        widget=dynamic_cast<const QWidget *>(p->device());
+
+    int          cls(widget ? classIndex(qtClassName(widget)) : -1),
+                 cols(colorsIndex(cg));
+    ETraceOption kind(optionKind(cat, element, opt));
+
+    itsStream << (Q_UINT8)REC_CALL << (Q_UINT8)cat << (Q_INT32)element
+              << (Q_INT16)r.x() << (Q_INT16)r.y() << (Q_INT16)r.width() << (Q_INT16)r.height()
+              << (Q_UINT32)flags << (Q_UINT32)controls << (Q_UINT32)active << (Q_INT16)cls
+              << (Q_INT16)(widget ? widget->width() : 0) << (Q_INT16)(widget ? widget->height() : 0)
+              << (Q_UINT16)cols << (Q_UINT8)kind;
+
+    if(OPT_INTS==kind)
+        itsStream << (Q_INT32)opt.lineWidth() << (Q_INT32)opt.midLineWidth();
+    else if(OPT_COLOR==kind)
+        itsStream << (Q_UINT32)opt.color().rgb();
+}
+
+int QtCRecorder::classIndex(const char *name)
+{
+    int index(itsClasses.findIndex(name));
+
+    if(-1==index)
+    {
+        itsStream << (Q_UINT8)REC_CLASS << QCString(name);
+        itsClasses.append(name);
+        index=itsClasses.count()-1;
+    }
+
+    return index;
+}
+
+int QtCRecorder::colorsIndex(const QColorGroup &cg)
+{
+    int index(itsColors.findIndex(cg));
+
+    if(-1==index)
+    {
+        itsStream << (Q_UINT8)REC_COLORS;
+        for(int i=0; i<QColorGroup::NColorRoles; ++i)
+            itsStream << (Q_UINT32)cg.color((QColorGroup::ColorRole)i).rgb();
+        itsColors.append(cg);
+        index=itsColors.count()-1;
+    }
+
+    return index;
+}
+
+QtCRecordScope::QtCRecordScope(QtCProfiler::ECategory cat, int element, const QWidget *widget, const QPainter *p,
+                               const QRect &r, const QColorGroup &cg, unsigned int flags, unsigned int controls,
+                               unsigned int active, const QStyleOption &opt)
+{
+    if(0==theDepth++ && QtCRecorder::instance())
+        QtCRecorder::instance()->record(cat, element, widget, p, r, cg, flags, controls, active, opt);
+}
+
+QtCRecordScope::~QtCRecordScope()
+{
+    theDepth--;
+}
+
+#endif
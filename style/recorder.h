@@ -0,0 +1,122 @@
+#ifndef __QTC_RECORDER_H__
+#define __QTC_RECORDER_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Draw-call recorder.
+
+  Compiled in along with the profiler. When QTCURVE_RECORD=<file> is set in the environment,
+  each call into the style's public drawing API is written to <file> - so that the calls made
+  by a real application can be replayed, and timed, by qtcurve-replay.
+
+  Only the outermost calls are recorded, as replaying these also replays the calls that they
+  make. The trace is a QDataStream of the following records, after an 8 byte "QTCTRACE" magic
+  and a 32-bit version:
+
+    REC_CLASS   <name>                                  - defines the next class index
+    REC_COLORS  <QColorGroup::NColorRoles x rgb>        - defines the next colour group index
+    REC_CALL    <category> <element> <x> <y> <w> <h> <flags> <controls> <active> <class>
+                <widget w> <widget h> <colour group> <option kind> [option values]
+
+  Widget classes are recorded as the nearest Qt class, as only these can be re-created by the
+  replayer. Options that refer to other objects (e.g. menu items and tabs) cannot be replayed,
+  so are recorded as OPT_OTHER.
+*/
+
+#include "profiler.h"
+
+#define QTC_TRACE_MAGIC   "QTCTRACE"
+#define QTC_TRACE_VERSION 1
+
+enum ETraceRecord
+{
+    REC_CLASS = 1,
+    REC_COLORS,
+    REC_CALL
+};
+
+enum ETraceOption
+{
+    OPT_DEFAULT,
+    OPT_INTS,   // lineWidth(), midLineWidth()
+    OPT_COLOR,  // color()
+    OPT_OTHER
+};
+
+#ifdef QTC_ENABLE_PROFILER
+
+#include <qstring.h>
+#include <qvaluelist.h>
+#include <qpalette.h>
+#include <qfile.h>
+#include <qdatastream.h>
+#include <qstyle.h>
+
+class QWidget;
+class QPainter;
+
+class QtCRecorder
+{
+    public:
+
+    static QtCRecorder * instance();
+
+    void record(QtCProfiler::ECategory cat, int element, const QWidget *widget, const QPainter *p,
+                const QRect &r, const QColorGroup &cg, unsigned int flags, unsigned int controls,
+                unsigned int active, const QStyleOption &opt);
+
+    private:
+
+    QtCRecorder(const QString &file);
+
+    static void cleanup();
+
+    int classIndex(const char *name);
+    int colorsIndex(const QColorGroup &cg);
+
+    QFile                   itsFile;
+    QDataStream             itsStream;
+    QValueList<QString>     itsClasses;
+    QValueList<QColorGroup> itsColors;
+};
+
+class QtCRecordScope
+{
+    public:
+
+    QtCRecordScope(QtCProfiler::ECategory cat, int element, const QWidget *widget, const QPainter *p,
+                   const QRect &r, const QColorGroup &cg, unsigned int flags, unsigned int controls,
+                   unsigned int active, const QStyleOption &opt);
+    ~QtCRecordScope();
+};
+
+#define QTC_RECORD(CAT, ELEMENT, WIDGET, PAINTER, RECT, CG, FLAGS, CONTROLS, ACTIVE, OPT) \
+    QtCRecordScope qtcRecordScope(QtCProfiler::CAT, (int)(ELEMENT), WIDGET, PAINTER, RECT, CG, FLAGS, \
+                                  CONTROLS, ACTIVE, OPT)
+
+#else
+
+#define QTC_RECORD(CAT, ELEMENT, WIDGET, PAINTER, RECT, CG, FLAGS, CONTROLS, ACTIVE, OPT)
+
+#endif
+
+#endif
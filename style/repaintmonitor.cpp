@@ -0,0 +1,131 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "repaintmonitor.h"
+#include <qwidget.h>
+#include <qtimer.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define RATE_PERIOD           1000 // ms
+#define THROTTLE_DELAY        100  // ms
+
+// A single paint of a widget will normally involve several calls into the style...
+#define PAINT_FACTOR          4
+
+RepaintMonitor * RepaintMonitor::create(QObject *parent)
+{
+    // Monitoring adds a lookup to every drawing call, so is only enabled on request...
+    const char *env=getenv("QTCURVE_REPAINT_LIMIT");
+    int        limit(env ? atoi(env) : 0);
+
+    return limit>0 ? new RepaintMonitor(parent, limit, NULL!=getenv("QTCURVE_REPAINT_THROTTLE")) : 0L;
+}
+
+RepaintMonitor::RepaintMonitor(QObject *parent, unsigned int limit, bool throttle)
+              : QObject(parent)
+              , itsLimit(limit)
+              , itsThrottle(throttle)
+              , itsTimer(new QTimer(this))
+{
+    connect(itsTimer, SIGNAL(timeout()), this, SLOT(flush()));
+}
+
+RepaintMonitor::~RepaintMonitor()
+{
+}
+
+bool RepaintMonitor::invalidate(QWidget *widget, const char *reason)
+{
+    Rate &r(rate(widget));
+
+    if(++r.invalidations<=itsLimit)
+        return true;
+
+    report(widget, r, itsLimit, "repaints", reason);
+
+    if(!itsThrottle)
+        return true;
+
+    if(!itsPending.contains(widget))
+        itsPending.append(widget);
+    if(!itsTimer->isActive())
+        itsTimer->start(THROTTLE_DELAY, true);
+    return false;
+}
+
+void RepaintMonitor::painted(const QWidget *widget)
+{
+    Rate &r(rate(widget));
+
+    if(++r.paints>itsLimit*PAINT_FACTOR)
+        report(widget, r, itsLimit*PAINT_FACTOR, "style calls", "paint");
+}
+
+void RepaintMonitor::flush()
+{
+    QValueList<QWidget *>::ConstIterator it(itsPending.begin()),
+                                         end(itsPending.end());
+
+    for(; it!=end; ++it)
+        (*it)->update();
+    itsPending.clear();
+}
+
+void RepaintMonitor::widgetDestroyed(QObject *o)
+{
+    itsRates.remove(static_cast<const QWidget *>(o));
+    itsPending.remove(static_cast<QWidget *>(o));
+}
+
+RepaintMonitor::Rate & RepaintMonitor::rate(const QWidget *widget)
+{
+    QMap<const QWidget *, Rate>::Iterator it(itsRates.find(widget));
+
+    if(it==itsRates.end())
+    {
+        connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(widgetDestroyed(QObject *)));
+        it=itsRates.insert(widget, Rate());
+        it.data().start.start();
+    }
+    else if(it.data().start.elapsed()>RATE_PERIOD)
+    {
+        it.data().start.restart();
+        it.data().invalidations=it.data().paints=0;
+    }
+
+    return it.data();
+}
+
+void RepaintMonitor::report(const QWidget *widget, Rate &r, unsigned int threshold, const char *what,
+                            const char *reason)
+{
+    if(r.reported)
+        return;
+
+    const QWidget *top(widget->topLevelWidget());
+
+    r.reported=true;
+    fprintf(stderr, "QtCurve: %s \"%s\" (in %s \"%s\") exceeded %u %s/second (%s)%s\n",
+            widget->className(), widget->name(), top->className(), top->name(), threshold, what, reason,
+            itsThrottle ? " - throttling" : "");
+}
+
+#include "repaintmonitor.moc"
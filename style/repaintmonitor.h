@@ -0,0 +1,83 @@
+#ifndef __REPAINT_MONITOR_H__
+#define __REPAINT_MONITOR_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Keeps track of how often each widget is invalidated by, or painted via, the style. Only
+  enabled if QTCURVE_REPAINT_LIMIT is set. If a widget exceeds this many repaints per second,
+  then a message is printed to stderr - once per widget. If QTCURVE_REPAINT_THROTTLE is set, then
+  any further style initiated repaints of that widget are coalesced into a single delayed
+  update until its rate drops below the limit.
+*/
+
+#include <qobject.h>
+#include <qvaluelist.h>
+#include <qmap.h>
+#include <qdatetime.h>
+
+class QWidget;
+class QTimer;
+
+class RepaintMonitor : public QObject
+{
+    Q_OBJECT
+
+    public:
+
+    static RepaintMonitor * create(QObject *parent);
+
+    virtual ~RepaintMonitor();
+
+    bool invalidate(QWidget *widget, const char *reason);
+    void painted(const QWidget *widget);
+
+    private slots:
+
+    void flush();
+    void widgetDestroyed(QObject *o);
+
+    private:
+
+    struct Rate
+    {
+        Rate() : invalidations(0), paints(0), reported(false) { }
+
+        QTime        start;
+        unsigned int invalidations,
+                     paints;
+        bool         reported;
+    };
+
+    RepaintMonitor(QObject *parent, unsigned int limit, bool throttle);
+
+    Rate & rate(const QWidget *widget);
+    void   report(const QWidget *widget, Rate &r, unsigned int threshold, const char *what,
+                  const char *reason);
+
+    unsigned int                itsLimit;
+    bool                        itsThrottle;
+    QTimer                      *itsTimer;
+    QMap<const QWidget *, Rate> itsRates;
+    QValueList<QWidget *>       itsPending;
+};
+
+#endif
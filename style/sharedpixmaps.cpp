@@ -0,0 +1,349 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "config.h"
+#include "sharedpixmaps.h"
+#include "profiler.h"
+#include <qimage.h>
+#include <qpaintdevice.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include "qtc_fixx11h.h"
+#include "xatoms.h"
+
+// Number of 32-bit values per entry - 2 hashes, pixmap, size, depth, owner, and cookie...
+#define ENTRY_LEN         7
+#define MAX_ENTRIES       1024
+// Prune the table, on start-up, if it has at least this many entries...
+#define PRUNE_ENTRIES     ((MAX_ENTRIES*3)/4)
+// Number of new entries to append to the table at once...
+#define PUBLISH_BATCH     16
+// Maximum number of pixmaps that this process will keep alive for others...
+#define MAX_PUBLISHED     128
+// How often, in ms, to re-read the table...
+#define REFRESH_PERIOD    1000
+
+static bool theXError=false;
+
+static int errorHandler(Display *, XErrorEvent *)
+{
+    theXError=true;
+    return 0;
+}
+
+// Two FNV-1a hashes, with different offsets, of the size and contents...
+static void hashImage(const QImage &img, unsigned long hash[2])
+{
+    unsigned int h0=2166136261U,
+                 h1=84696351U;
+    int          w(img.width()),
+                 h(img.height());
+
+    h0=(h0^w)*16777619U;
+    h1=(h1^h)*16777619U;
+    for(int y=0; y<h; ++y)
+    {
+        const unsigned char *line=img.scanLine(y);
+
+        for(int x=0; x<w*4; ++x)
+        {
+            h0=(h0^line[x])*16777619U;
+            h1=(h1^line[x])*16777619U;
+        }
+    }
+
+    hash[0]=h0;
+    hash[1]=h1;
+}
+
+// Whether the owner window exists, and has the cookie. Errors are reported via the caller's handler...
+static bool queryOwner(unsigned long owner, unsigned long cookie)
+{
+    Atom          type;
+    int           format;
+    unsigned long nItems,
+                  after;
+    unsigned char *data=0L;
+    bool          alive(false);
+
+    if(Success==XGetWindowProperty(qt_xdisplay(), owner, qtcAtom(ATOM_SHARED_PIXMAPS_OWNER), 0, 1, False,
+                                   XA_CARDINAL, &type, &format, &nItems, &after, &data) && data)
+    {
+        alive=XA_CARDINAL==type && 32==format && 1==nItems && (((const long *)data)[0]&0xFFFFFFFF)==cookie;
+        XFree(data);
+    }
+
+    return alive;
+}
+
+void SharedPixmaps::toProperty(const QValueList<Entry> &entries, long *data)
+{
+    QValueList<Entry>::ConstIterator it(entries.begin()),
+                                     end(entries.end());
+
+    for(; it!=end; ++it)
+    {
+        *data++=(long)(*it).hash[0];
+        *data++=(long)(*it).hash[1];
+        *data++=(long)(*it).pixmap;
+        *data++=(long)(*it).size;
+        *data++=(long)(*it).depth;
+        *data++=(long)(*it).owner;
+        *data++=(long)(*it).cookie;
+    }
+}
+
+SharedPixmaps * SharedPixmaps::create()
+{
+    const char *env=getenv("QTCURVE_SHARE_PIXMAPS");
+
+    return env && 0!=atoi(env) ? new SharedPixmaps() : 0L;
+}
+
+SharedPixmaps::SharedPixmaps()
+             : itsTableFull(false)
+             , itsOwner(0)
+             , itsCookie(0)
+             , itsGc(0L)
+{
+    refresh();
+    if(itsEntries.count()>=PRUNE_ENTRIES)
+        prune();
+}
+
+SharedPixmaps::~SharedPixmaps()
+{
+    // The style is deleted before QApplication closes the display. Destroying the owner window
+    // means that other processes ignore our entries from now on...
+    if(itsOwner)
+        XDestroyWindow(qt_xdisplay(), itsOwner);
+    if(itsGc)
+        XFreeGC(qt_xdisplay(), (GC)itsGc);
+}
+
+bool SharedPixmaps::fetch(QPixmap &pix, const QImage &img)
+{
+    if(img.hasAlphaBuffer() || 32!=img.depth())
+        return false;
+
+    if(!itsRefreshed.isValid() || itsRefreshed.elapsed()>REFRESH_PERIOD)
+        refresh();
+
+    unsigned long hash[2],
+                  size((img.width()<<16)|img.height()),
+                  depth(QPaintDevice::x11AppDepth());
+
+    hashImage(img, hash);
+
+    QValueList<Entry>::ConstIterator it(itsEntries.begin()),
+                                     end(itsEntries.end());
+
+    for(; it!=end; ++it)
+        if((*it).hash[0]==hash[0] && (*it).hash[1]==hash[1] && (*it).size==size && (*it).depth==depth &&
+           (*it).owner!=itsOwner && ownerAlive((*it).owner, (*it).cookie))
+        {
+            Display       *dpy=qt_xdisplay();
+            XErrorHandler oldHandler=XSetErrorHandler(errorHandler);
+
+            if(pix.width()!=img.width() || pix.height()!=img.height())
+                pix.resize(img.width(), img.height());
+            if(!itsGc)
+                itsGc=XCreateGC(dpy, pix.handle(), 0, 0L);
+
+            // The owner may have exited since it was last checked - in which case the pixmap may have
+            // gone, or its ID been re-used. So, check again after copying. This is a round trip, so any
+            // error from the copy is also reported. If the owner is still running, then the pixmap was
+            // still its own when copied...
+            theXError=false;
+            XCopyArea(dpy, (*it).pixmap, pix.handle(), (GC)itsGc, 0, 0, img.width(), img.height(), 0, 0);
+
+            bool ok(queryOwner((*it).owner, (*it).cookie) && !theXError);
+
+            XSetErrorHandler(oldHandler);
+
+            if(ok)
+            {
+                QTC_COUNT("upload bytes: shared", img.numBytes());
+                return true;
+            }
+
+            // ...the caller uploads the image into pix instead.
+            itsOwners[(*it).owner]=false;
+            return false;
+        }
+
+    return false;
+}
+
+void SharedPixmaps::publish(const QPixmap &pix, const QImage &img)
+{
+    if(img.hasAlphaBuffer() || 32!=img.depth() || itsTableFull || itsPublished.count()>=MAX_PUBLISHED)
+        return;
+
+    Display *dpy=qt_xdisplay();
+
+    if(!itsOwner)
+    {
+        XSetWindowAttributes attr;
+
+        itsOwner=XCreateWindow(dpy, qt_xrootwin(), -1, -1, 1, 1, 0, CopyFromParent, InputOnly, CopyFromParent,
+                               0, &attr);
+        itsCookie=(((unsigned long)getpid())<<16)^((unsigned long)time(0))^((unsigned long)rand());
+        itsCookie&=0xFFFFFFFF;
+
+        long cookie(itsCookie);
+
+        XChangeProperty(dpy, itsOwner, qtcAtom(ATOM_SHARED_PIXMAPS_OWNER), XA_CARDINAL, 32, PropModeReplace,
+                        (unsigned char *)&cookie, 1);
+    }
+
+    // Stop publishing until the table has been pruned (see refresh) - rather than re-checking
+    // it upon each tile...
+    if(itsEntries.count()+itsPending.count()>=MAX_ENTRIES)
+    {
+        itsTableFull=true;
+        return;
+    }
+
+    Entry entry;
+
+    hashImage(img, entry.hash);
+    entry.pixmap=pix.handle();
+    entry.size=(img.width()<<16)|img.height();
+    entry.depth=pix.depth();
+    entry.owner=itsOwner;
+    entry.cookie=itsCookie;
+
+    // Keep a reference, so that the pixmap is not freed if our own cache drops it...
+    itsPublished.append(pix);
+    itsPending.append(entry);
+    QTC_COUNT("shared pixmaps published", 1);
+
+    if(itsPending.count()>=PUBLISH_BATCH || !itsFlushed.isValid() || itsFlushed.elapsed()>REFRESH_PERIOD)
+        flush();
+}
+
+// Append the pending entries to the table, with a single request...
+void SharedPixmaps::flush()
+{
+    if(itsPending.isEmpty())
+        return;
+
+    long *data=new long[itsPending.count()*ENTRY_LEN];
+
+    toProperty(itsPending, data);
+    XChangeProperty(qt_xdisplay(), qt_xrootwin(), qtcAtom(ATOM_SHARED_PIXMAPS), XA_CARDINAL, 32, PropModeAppend,
+                    (unsigned char *)data, itsPending.count()*ENTRY_LEN);
+    delete [] data;
+
+    itsEntries+=itsPending;
+    itsPending.clear();
+    itsFlushed.restart();
+}
+
+void SharedPixmaps::refresh()
+{
+    Atom          type;
+    int           format;
+    unsigned long nItems,
+                  after;
+    unsigned char *data=0L;
+
+    flush();
+    itsEntries.clear();
+    itsOwners.clear();
+    itsRefreshed.restart();
+
+    if(Success==XGetWindowProperty(qt_xdisplay(), qt_xrootwin(), qtcAtom(ATOM_SHARED_PIXMAPS), 0,
+                                   MAX_ENTRIES*ENTRY_LEN, False, XA_CARDINAL, &type, &format, &nItems,
+                                   &after, &data) && data)
+    {
+        if(XA_CARDINAL==type && 32==format)
+        {
+            const long *values=(const long *)data;
+
+            for(unsigned long i=0; i+ENTRY_LEN<=nItems; i+=ENTRY_LEN)
+            {
+                Entry entry;
+
+                entry.hash[0]=values[i]&0xFFFFFFFF;
+                entry.hash[1]=values[i+1]&0xFFFFFFFF;
+                entry.pixmap=values[i+2];
+                entry.size=values[i+3];
+                entry.depth=values[i+4];
+                entry.owner=values[i+5];
+                entry.cookie=values[i+6]&0xFFFFFFFF;
+                itsEntries.append(entry);
+            }
+        }
+        XFree(data);
+    }
+
+    // Another process has pruned the table, so publishing may resume...
+    if(itsTableFull && itsEntries.count()<MAX_ENTRIES)
+        itsTableFull=false;
+}
+
+// Remove the entries of processes that have exited - only called as the process starts, so never
+// whilst painting...
+void SharedPixmaps::prune()
+{
+    QValueList<Entry>           alive;
+    QValueList<Entry>::Iterator it(itsEntries.begin()),
+                                end(itsEntries.end());
+
+    for(; it!=end; ++it)
+        if(ownerAlive((*it).owner, (*it).cookie))
+            alive.append(*it);
+
+    if(alive.count()!=itsEntries.count())
+    {
+        long *data=new long[alive.count()*ENTRY_LEN];
+
+        toProperty(alive, data);
+        XChangeProperty(qt_xdisplay(), qt_xrootwin(), qtcAtom(ATOM_SHARED_PIXMAPS), XA_CARDINAL, 32, PropModeReplace,
+                        (unsigned char *)data, alive.count()*ENTRY_LEN);
+        delete [] data;
+        itsEntries=alive;
+    }
+}
+
+bool SharedPixmaps::ownerAlive(unsigned long owner, unsigned long cookie)
+{
+    QMap<unsigned long, bool>::ConstIterator it(itsOwners.find(owner));
+
+    if(it!=itsOwners.end())
+        return it.data();
+
+    XErrorHandler oldHandler=XSetErrorHandler(errorHandler);
+
+    // The window may have gone, in which case BadWindow is reported...
+    theXError=false;
+
+    bool alive(queryOwner(owner, cookie) && !theXError);
+
+    XSetErrorHandler(oldHandler);
+
+    itsOwners[owner]=alive;
+    return alive;
+}
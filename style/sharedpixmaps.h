@@ -0,0 +1,94 @@
+#ifndef __SHARED_PIXMAPS_H__
+#define __SHARED_PIXMAPS_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Opt-in (QTCURVE_SHARE_PIXMAPS=1) sharing of generated tiles between processes.
+
+  Each process that uploads a tile publishes its pixmap ID, keyed by a hash of the tile's
+  contents, in the _QTCURVE_SHARED_PIXMAPS property of the root window. Other processes that
+  generate the same contents then copy the tile server side, rather than uploading it again.
+
+  Published pixmaps are only valid whilst their process is running - so each publisher also
+  creates an (unmapped) owner window, tagged with a random cookie. Entries are only used if
+  their owner window still exists and has the same cookie - and this is checked again after
+  copying, so that a tile copied from a process that has since exited is never used.
+
+  New entries are appended in batches, to limit the PropertyNotify events sent to other root
+  window clients. Entries of processes that have exited are pruned as each process starts, if
+  the table is nearly full. The server is never grabbed - if another process appends whilst the
+  table is being pruned, its entries may be lost, which only means that they are not shared. Once
+  the table is full, this process stops publishing until it has been pruned.
+*/
+
+#include <qvaluelist.h>
+#include <qmap.h>
+#include <qdatetime.h>
+#include <qpixmap.h>
+
+class QImage;
+
+class SharedPixmaps
+{
+    public:
+
+    static SharedPixmaps * create();
+
+    ~SharedPixmaps();
+
+    bool fetch(QPixmap &pix, const QImage &img);
+    void publish(const QPixmap &pix, const QImage &img);
+
+    private:
+
+    struct Entry
+    {
+        unsigned long hash[2],
+                      pixmap,
+                      size,
+                      depth,
+                      owner,
+                      cookie;
+    };
+
+    SharedPixmaps();
+
+    static void toProperty(const QValueList<Entry> &entries, long *data);
+
+    void refresh();
+    void flush();
+    void prune();
+    bool ownerAlive(unsigned long owner, unsigned long cookie);
+
+    QValueList<Entry>          itsEntries,
+                               itsPending;
+    QTime                      itsRefreshed,
+                               itsFlushed;
+    bool                       itsTableFull;
+    QMap<unsigned long, bool>  itsOwners;
+    unsigned long              itsOwner,
+                               itsCookie;
+    void                       *itsGc;
+    QValueList<QPixmap>        itsPublished;
+};
+
+#endif
@@ -0,0 +1,189 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "config.h"
+#include "warmup.h"
+#include "qtcurve.h"
+#include "profiler.h"
+#include <qtimer.h>
+#include <stdlib.h>
+#ifdef QT_THREAD_SUPPORT
+#include <qthread.h>
+#endif
+
+// Number of tiles uploaded (and, without a worker thread, rendered) per idle call - so that the
+// event loop is never blocked for long...
+#define TILES_PER_IDLE 4
+// How often, in ms, to check for tiles rendered by the worker thread...
+#define POLL_PERIOD    10
+
+#ifdef QT_THREAD_SUPPORT
+class WarmUpThread : public QThread
+{
+    public:
+
+    WarmUpThread(WarmUp *warmUp) : itsWarmUp(warmUp) { }
+
+    protected:
+
+    void run() { itsWarmUp->render(); }
+
+    private:
+
+    WarmUp *itsWarmUp;
+};
+#endif
+
+bool WarmUp::enabled()
+{
+    const char *env=getenv("QTCURVE_WARMUP");
+
+    return env && 0!=atoi(env);
+}
+
+WarmUp::WarmUp(QtCurveStyle *style)
+      : QObject(style)
+      , itsStyle(style)
+      , itsRendered(0)
+      , itsUploaded(0)
+      , itsPrimitivesDone(true)
+      , itsStopped(false)
+      , itsTimer(new QTimer(this))
+#ifdef QT_THREAD_SUPPORT
+      , itsThread(0L)
+#endif
+{
+    connect(itsTimer, SIGNAL(timeout()), this, SLOT(idle()));
+}
+
+WarmUp::~WarmUp()
+{
+    stop();
+}
+
+void WarmUp::start(const QValueVector<Job> &jobs)
+{
+    stop();
+
+    itsJobs=jobs;
+    itsRendered=itsUploaded=0;
+    itsPrimitivesDone=false;
+    itsStopped=false;
+
+    // The images are created here, so that the worker only writes their contents...
+    for(unsigned int i=0; i<itsJobs.count(); ++i)
+        itsJobs[i].img.create(itsJobs[i].r.width(), itsJobs[i].r.height(), 32);
+
+#ifdef QT_THREAD_SUPPORT
+    if(itsJobs.count())
+    {
+        itsThread=new WarmUpThread(this);
+        itsThread->start(QThread::LowPriority);
+    }
+    itsTimer->start(itsThread ? POLL_PERIOD : 0);
+#else
+    itsTimer->start(0);
+#endif
+}
+
+void WarmUp::stop()
+{
+    itsStopped=true;
+#ifdef QT_THREAD_SUPPORT
+    if(itsThread)
+    {
+        itsThread->wait();
+        delete itsThread;
+        itsThread=0L;
+    }
+#endif
+    itsTimer->stop();
+    itsJobs.clear();
+    itsRendered=itsUploaded=0;
+}
+
+bool WarmUp::active() const
+{
+    return itsTimer->isActive();
+}
+
+void WarmUp::render()
+{
+    unsigned int count(itsJobs.count());
+
+    for(unsigned int i=0; i<count && !itsStopped; ++i)
+    {
+        Job &job(itsJobs[i]);
+
+        itsStyle->renderWarmUpTile(job.base, job.bgnd, job.r, job.horiz, job.sel, job.app, job.widget, job.img);
+#ifdef QT_THREAD_SUPPORT
+        itsMutex.lock();
+#endif
+        itsRendered=i+1;
+#ifdef QT_THREAD_SUPPORT
+        itsMutex.unlock();
+#endif
+    }
+}
+
+void WarmUp::idle()
+{
+#ifdef QT_THREAD_SUPPORT
+    if(!itsThread)
+#endif
+    {
+        for(int i=0; i<TILES_PER_IDLE && itsRendered<itsJobs.count(); ++i, ++itsRendered)
+        {
+            Job &job(itsJobs[itsRendered]);
+
+            itsStyle->renderWarmUpTile(job.base, job.bgnd, job.r, job.horiz, job.sel, job.app, job.widget, job.img);
+        }
+    }
+
+    unsigned int available(rendered());
+
+    for(int i=0; i<TILES_PER_IDLE && itsUploaded<available; ++i, ++itsUploaded)
+    {
+        itsStyle->addWarmUpTile(itsJobs[itsUploaded].key, itsJobs[itsUploaded].img);
+        itsJobs[itsUploaded].img.reset();
+        QTC_COUNT("warm-up tiles", 1);
+    }
+
+    if(itsUploaded==itsJobs.count())
+    {
+        if(!itsPrimitivesDone)
+        {
+            itsStyle->warmUpPrimitives();
+            itsPrimitivesDone=true;
+        }
+        stop();
+    }
+}
+
+unsigned int WarmUp::rendered()
+{
+#ifdef QT_THREAD_SUPPORT
+    QMutexLocker locker(&itsMutex);
+#endif
+
+    return itsRendered;
+}
+
+#include "warmup.moc"
@@ -0,0 +1,102 @@
+#ifndef __QTC_WARMUP_H__
+#define __QTC_WARMUP_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Opt-in (QTCURVE_WARMUP=1) pre-rendering of commonly used tiles, started once the application
+  has been polished - so that the first windows shown do not have to generate these whilst
+  painting.
+
+  Gradient tiles are drawn into QImages - on a worker thread if Qt was built with thread support,
+  otherwise a few at a time whilst idle. The images are created, uploaded, and placed into the
+  pixmap cache on the GUI thread, so the worker only ever writes their pixel data. Indicators and
+  arrows are drawn via QPainter, so these are drawn into a scratch pixmap - on the GUI thread,
+  whilst idle - which places them into their caches.
+*/
+
+#include <qobject.h>
+#include <qvaluevector.h>
+#include <qstring.h>
+#include <qcolor.h>
+#include <qrect.h>
+#include <qimage.h>
+#ifdef QT_THREAD_SUPPORT
+#include <qmutex.h>
+#endif
+
+class QTimer;
+class QtCurveStyle;
+class WarmUpThread;
+
+class WarmUp : public QObject
+{
+    Q_OBJECT
+
+    public:
+
+    struct Job
+    {
+        QString key;
+        QColor  base,
+                bgnd;
+        QRect   r;
+        bool    horiz,
+                sel;
+        int     app,
+                widget;
+        QImage  img;
+    };
+
+    static bool enabled();
+
+    WarmUp(QtCurveStyle *style);
+    ~WarmUp();
+
+    void start(const QValueVector<Job> &jobs);
+    void stop();
+    bool active() const;
+
+    // Called on the worker thread...
+    void render();
+
+    private slots:
+
+    void idle();
+
+    private:
+
+    unsigned int rendered();
+
+    QtCurveStyle       *itsStyle;
+    QValueVector<Job>  itsJobs;
+    unsigned int       itsRendered,
+                       itsUploaded;
+    bool               itsPrimitivesDone;
+    volatile bool      itsStopped;
+    QTimer             *itsTimer;
+#ifdef QT_THREAD_SUPPORT
+    WarmUpThread       *itsThread;
+    QMutex             itsMutex;
+#endif
+};
+
+#endif
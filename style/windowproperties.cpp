@@ -0,0 +1,124 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include "windowproperties.h"
+#include <qwidget.h>
+#include <qtimer.h>
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include "qtc_fixx11h.h"
+#include "xatoms.h"
+
+WindowProperties::WindowProperties(QObject *parent)
+                : QObject(parent)
+                , itsTimer(new QTimer(this))
+{
+    connect(itsTimer, SIGNAL(timeout()), this, SLOT(flush()));
+}
+
+WindowProperties::~WindowProperties()
+{
+}
+
+void WindowProperties::set(const QWidget *widget, EProp prop, unsigned long value)
+{
+    QMap<const QWidget *, Props>::Iterator it(itsProps.find(widget));
+
+    if(it==itsProps.end())
+    {
+        connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(widgetDestroyed(QObject *)));
+        it=itsProps.insert(widget, Props());
+    }
+
+    Props        &p(it.data());
+    WId          id(widget->parentWidget() ? widget->parentWidget()->winId() : widget->winId());
+    unsigned int bit(1<<prop);
+
+    // If the window has been re-created, then nothing has been written to it yet...
+    if(id!=p.id)
+    {
+        p.id=id;
+        p.published=0;
+    }
+
+    if(p.published&bit && p.values[prop]==value)
+        p.pending&=~bit;
+    else
+    {
+        p.pending|=bit;
+        p.pendingValues[prop]=value;
+        if(!itsPending.contains(widget))
+            itsPending.append(widget);
+        if(!itsTimer->isActive())
+            itsTimer->start(0, true);
+    }
+}
+
+void WindowProperties::flush(const QWidget *widget)
+{
+    QMap<const QWidget *, Props>::Iterator it(itsProps.find(widget));
+
+    if(it!=itsProps.end())
+        write(it.data());
+    itsPending.remove(widget);
+}
+
+void WindowProperties::flush()
+{
+    QValueList<const QWidget *>::ConstIterator it(itsPending.begin()),
+                                               end(itsPending.end());
+
+    for(; it!=end; ++it)
+    {
+        QMap<const QWidget *, Props>::Iterator p(itsProps.find(*it));
+
+        if(p!=itsProps.end())
+            write(p.data());
+    }
+    itsPending.clear();
+}
+
+void WindowProperties::widgetDestroyed(QObject *o)
+{
+    itsProps.remove(static_cast<const QWidget *>(o));
+    itsPending.remove(static_cast<const QWidget *>(o));
+}
+
+void WindowProperties::write(Props &p)
+{
+    if(p.pending&(1<<PROP_MENU_SIZE))
+    {
+        unsigned short size(p.pendingValues[PROP_MENU_SIZE]);
+
+        XChangeProperty(qt_xdisplay(), p.id, qtcAtom(ATOM_MENU_SIZE), XA_CARDINAL, 16, PropModeReplace, (unsigned char *)&size, 1);
+    }
+
+    if(p.pending&(1<<PROP_BGND))
+        XChangeProperty(qt_xdisplay(), p.id, qtcAtom(ATOM_BGND), XA_CARDINAL, 32, PropModeReplace,
+                        (unsigned char *)&p.pendingValues[PROP_BGND], 1);
+
+    for(int i=0; i<NUM_PROPS; ++i)
+        if(p.pending&(1<<i))
+            p.values[i]=p.pendingValues[i];
+    p.published|=p.pending;
+    p.pending=0;
+}
+
+#include "windowproperties.moc"
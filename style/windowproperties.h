@@ -0,0 +1,85 @@
+#ifndef __WINDOW_PROPERTIES_H__
+#define __WINDOW_PROPERTIES_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  Publishes the X properties read by the window decoration (menubar size, and background
+  appearance). The last value written to each window is remembered, so unchanged values are
+  not re-sent, and changes are written together once control returns to the event loop. Any
+  pending changes for a window are written before it is shown, so that the decoration always
+  sees them when the window is mapped.
+*/
+
+#include <qobject.h>
+#include <qvaluelist.h>
+#include <qmap.h>
+#include <qwindowdefs.h>
+
+class QWidget;
+class QTimer;
+
+class WindowProperties : public QObject
+{
+    Q_OBJECT
+
+    public:
+
+    enum EProp
+    {
+        PROP_MENU_SIZE,
+        PROP_BGND,
+
+        NUM_PROPS
+    };
+
+    WindowProperties(QObject *parent);
+    virtual ~WindowProperties();
+
+    void set(const QWidget *widget, EProp prop, unsigned long value);
+    void flush(const QWidget *widget);
+
+    private slots:
+
+    void flush();
+    void widgetDestroyed(QObject *o);
+
+    private:
+
+    struct Props
+    {
+        Props() : id(0), published(0), pending(0) { }
+
+        WId           id;
+        unsigned int  published,  // Bitmask of properties that have been written...
+                      pending;    // ...and of those waiting to be written.
+        unsigned long values[NUM_PROPS],
+                      pendingValues[NUM_PROPS];
+    };
+
+    void write(Props &p);
+
+    QTimer                       *itsTimer;
+    QMap<const QWidget *, Props> itsProps;
+    QValueList<const QWidget *>  itsPending;
+};
+
+#endif
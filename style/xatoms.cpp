@@ -0,0 +1,53 @@
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+#include <qwindowdefs.h>
+#include "config.h"
+#include "common.h"
+#include "xatoms.h"
+
+// Must be in the same order as EAtom...
+static const char * constAtomNames[NUM_ATOMS]=
+{
+    "_NET_WM_MOVERESIZE",
+    "_NET_WM_STATE",
+    "_NET_WM_STATE_SKIP_PAGER",
+    "_NET_WM_STATE_SKIP_TASKBAR",
+    "_NET_WM_STATE_ABOVE",
+    "_NET_WM_STATE_STAYS_ON_TOP",
+    MENU_SIZE_ATOM,
+    BGND_ATOM,
+    "_QTCURVE_SHARED_PIXMAPS",
+    "_QTCURVE_SHARED_PIXMAPS_OWNER"
+};
+
+Atom qtcAtom(EAtom atom)
+{
+    static Atom atoms[NUM_ATOMS];
+    static bool interned=false;
+
+    if(!interned)
+    {
+        XInternAtoms(qt_xdisplay(), (char **)constAtomNames, NUM_ATOMS, False, atoms);
+        interned=true;
+    }
+
+    return atoms[atom];
+}
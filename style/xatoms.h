@@ -0,0 +1,50 @@
+#ifndef __QTC_XATOMS_H__
+#define __QTC_XATOMS_H__
+
+/*
+  QtCurve (C) Craig Drummond, 2007 - 2010 craig.p.drummond@gmail.com
+
+  ----
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public
+  License version 2 as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; see the file COPYING.  If not, write to
+  the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+  Boston, MA 02110-1301, USA.
+*/
+
+/*
+  All of the X atoms used by the style. These are interned together, with a single request, the
+  first time that any of them is needed - so merely loading the style does not touch the display.
+*/
+
+#include <X11/Xlib.h>
+#include "qtc_fixx11h.h"
+
+enum EAtom
+{
+    ATOM_NET_WM_MOVERESIZE,
+    ATOM_NET_WM_STATE,
+    ATOM_NET_WM_STATE_SKIP_PAGER,
+    ATOM_NET_WM_STATE_SKIP_TASKBAR,
+    ATOM_NET_WM_STATE_ABOVE,
+    ATOM_NET_WM_STATE_STAYS_ON_TOP,
+    ATOM_MENU_SIZE,
+    ATOM_BGND,
+    ATOM_SHARED_PIXMAPS,
+    ATOM_SHARED_PIXMAPS_OWNER,
+
+    NUM_ATOMS
+};
+
+extern Atom qtcAtom(EAtom atom);
+
+#endif